@@ -0,0 +1,56 @@
+// benchmarks/AsteroidFieldBench.cpp
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <random>
+#include "AsteroidField.hpp"
+#include "GameObjectManager.hpp"
+
+namespace {
+
+std::unique_ptr<Asteroid> randomAsteroid(std::mt19937& gen) {
+    std::uniform_real_distribution<float> xDist(0.0f, WINDOW_WIDTH);
+    std::uniform_real_distribution<float> yDist(0.0f, WINDOW_HEIGHT);
+    std::uniform_real_distribution<float> speedDist(-ASTEROID_MAX_SPEED, ASTEROID_MAX_SPEED);
+
+    auto asteroid = std::make_unique<Asteroid>(Asteroid::Size::Small);
+    asteroid->setPosition(sf::Vector2f(xDist(gen), yDist(gen)));
+    asteroid->setVelocity(sf::Vector2f(speedDist(gen), speedDist(gen)));
+    return asteroid;
+}
+
+void BM_AsteroidFieldUpdate(benchmark::State& state) {
+    std::mt19937 gen(42);
+    AsteroidField field;
+    field.reserve(state.range(0));
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        field.add(*randomAsteroid(gen));
+    }
+
+    for (auto _ : state) {
+        field.update(1.0f / 60.0f);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AsteroidFieldUpdate)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMicrosecond);
+
+// Same work through the per-object virtual path
+void BM_AsteroidObjectUpdate(benchmark::State& state) {
+    std::mt19937 gen(42);
+    GameObjectManager<Asteroid> manager;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        manager.spawn(randomAsteroid(gen));
+    }
+    manager.update(0.0f);
+
+    for (auto _ : state) {
+        manager.update(1.0f / 60.0f);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AsteroidObjectUpdate)->RangeMultiplier(10)->Range(1000, 1000000)->Unit(benchmark::kMicrosecond);
+
+} // namespace
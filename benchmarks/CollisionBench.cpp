@@ -0,0 +1,92 @@
+// benchmarks/CollisionBench.cpp
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <memory>
+#include <random>
+#include <vector>
+#include "CollisionManager.hpp"
+#include "SpatialHash.hpp"
+
+namespace {
+
+// Keeps asteroid density at the default game's level (4 large asteroids on
+// an 800x600 screen) so that only the entity count changes between runs.
+struct CollisionWorld {
+    explicit CollisionWorld(int asteroidCount)
+        : grid(1.0f, 1.0f, ASTEROID_GRID_CELL_SIZE) {
+        float scale = std::sqrt(asteroidCount / static_cast<float>(INITIAL_ASTEROID_COUNT));
+        world = sf::Vector2f(WINDOW_WIDTH * scale, WINDOW_HEIGHT * scale);
+        grid.configure(world.x, world.y, ASTEROID_GRID_CELL_SIZE);
+
+        std::mt19937 gen(1234);
+        std::uniform_real_distribution<float> xDist(0.0f, world.x);
+        std::uniform_real_distribution<float> yDist(0.0f, world.y);
+        std::uniform_int_distribution<int> sizeDist(0, 2);
+
+        for (int i = 0; i < asteroidCount; ++i) {
+            auto asteroid = std::make_unique<Asteroid>(static_cast<Asteroid::Size>(sizeDist(gen)));
+            asteroid->setPosition(sf::Vector2f(xDist(gen), yDist(gen)));
+            asteroids.push_back(std::move(asteroid));
+        }
+
+        // One bullet for every four asteroids keeps the query side busy too
+        for (int i = 0; i < asteroidCount / 4 + 1; ++i) {
+            bullets.push_back(std::make_unique<Bullet>(sf::Vector2f(xDist(gen), yDist(gen)), 0.0f));
+        }
+    }
+
+    sf::Vector2f world;
+    SpatialHash grid;
+    std::vector<std::unique_ptr<Asteroid>> asteroids;
+    std::vector<std::unique_ptr<Bullet>> bullets;
+};
+
+bool overlaps(const CollisionWorld& w, const Bullet& bullet, const Asteroid& asteroid) {
+    return CollisionManager::circlesOverlap(bullet.getPosition(), bullet.getRadius(),
+                                            asteroid.getPosition(), asteroid.getRadius(), w.world);
+}
+
+void BM_BroadphaseCollisions(benchmark::State& state) {
+    CollisionWorld w(static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        w.grid.clear();
+        for (size_t i = 0; i < w.asteroids.size(); ++i) {
+            w.grid.insert(static_cast<uint32_t>(i), w.asteroids[i]->getPosition(), w.asteroids[i]->getRadius());
+        }
+        w.grid.build();
+
+        size_t hits = 0;
+        for (const auto& bullet : w.bullets) {
+            w.grid.query(bullet->getPosition(), bullet->getRadius(), [&](uint32_t id) {
+                hits += overlaps(w, *bullet, *w.asteroids[id]);
+            });
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+
+    state.SetComplexityN(state.range(0));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BroadphaseCollisions)->RangeMultiplier(4)->Range(4, 100000)->Complexity(benchmark::oN);
+
+// The old all-pairs sweep, for comparison at small counts
+void BM_BruteForceCollisions(benchmark::State& state) {
+    CollisionWorld w(static_cast<int>(state.range(0)));
+
+    for (auto _ : state) {
+        size_t hits = 0;
+        for (const auto& bullet : w.bullets) {
+            for (const auto& asteroid : w.asteroids) {
+                hits += overlaps(w, *bullet, *asteroid);
+            }
+        }
+        benchmark::DoNotOptimize(hits);
+    }
+
+    state.SetComplexityN(state.range(0));
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BruteForceCollisions)->RangeMultiplier(4)->Range(4, 16384)->Complexity(benchmark::oNSquared);
+
+} // namespace
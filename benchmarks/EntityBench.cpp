@@ -0,0 +1,81 @@
+// benchmarks/EntityBench.cpp
+#include <benchmark/benchmark.h>
+#include <memory>
+#include <random>
+#include <vector>
+#include "EntityStore.hpp"
+#include "GameObjectManager.hpp"
+#include "Asteroid.hpp"
+
+// Per-entity update cost of the three ways to hold entities: base-class
+// pointers (a virtual call per object), GameObjectManager's pooled pointers
+// to a final type, and EntityStore's contiguous objects.
+
+namespace {
+
+constexpr float STEP = 1.0f / 30.0f;
+
+template<typename Spawn>
+void spawnAsteroids(int64_t count, Spawn spawn) {
+    std::mt19937 gen(42);
+    std::uniform_real_distribution<float> xDist(0.0f, WINDOW_WIDTH);
+    std::uniform_real_distribution<float> yDist(0.0f, WINDOW_HEIGHT);
+    std::uniform_real_distribution<float> speedDist(-ASTEROID_MAX_SPEED, ASTEROID_MAX_SPEED);
+    Random rng(5);
+    for (int64_t i = 0; i < count; ++i) {
+        Asteroid& asteroid = spawn(rng);
+        asteroid.setPosition(sf::Vector2f(xDist(gen), yDist(gen)));
+        asteroid.setVelocity(sf::Vector2f(speedDist(gen), speedDist(gen)));
+    }
+}
+
+void BM_EntityUpdateVirtual(benchmark::State& state) {
+    std::vector<std::unique_ptr<GameObject>> objects;
+    spawnAsteroids(state.range(0), [&](Random& rng) -> Asteroid& {
+        auto asteroid = std::make_unique<Asteroid>(Asteroid::Size::Small, rng);
+        Asteroid& ref = *asteroid;
+        objects.push_back(std::move(asteroid));
+        return ref;
+    });
+
+    for (auto _ : state) {
+        for (auto& object : objects) {
+            object->update(STEP);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EntityUpdateVirtual)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMicrosecond);
+
+void BM_EntityUpdateManager(benchmark::State& state) {
+    GameObjectManager<Asteroid> manager;
+    spawnAsteroids(state.range(0), [&](Random& rng) -> Asteroid& {
+        return *manager.spawn(Asteroid::Size::Small, rng);
+    });
+    manager.update(0.0f);
+
+    for (auto _ : state) {
+        manager.update(STEP);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EntityUpdateManager)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMicrosecond);
+
+void BM_EntityUpdateStore(benchmark::State& state) {
+    EntityStore<Asteroid> store;
+    store.reserve(state.range(0));
+    spawnAsteroids(state.range(0), [&](Random& rng) -> Asteroid& {
+        return store.spawn(Asteroid::Size::Small, rng);
+    });
+
+    for (auto _ : state) {
+        store.update(STEP);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_EntityUpdateStore)->RangeMultiplier(10)->Range(10000, 1000000)->Unit(benchmark::kMicrosecond);
+
+} // namespace
@@ -0,0 +1,65 @@
+// benchmarks/ParticleBench.cpp
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include "ParticleSystem.hpp"
+#include "Random.hpp"
+
+namespace {
+
+// A full ring of particles with lifetimes long enough that none retire
+void fill(ParticleSystem& particles, size_t count) {
+    Random rng(42);
+    particles.setCapacity(count);
+    particles.setDrag(1.5f);
+    for (size_t i = 0; i < count; ++i) {
+        float angle = rng.uniform(0.0f, 2.0f * M_PI);
+        float speed = rng.uniform(20.0f, 160.0f);
+        particles.emit(sf::Vector2f(rng.uniform(0.0f, 800.0f), rng.uniform(0.0f, 600.0f)),
+                       sf::Vector2f(std::cos(angle), std::sin(angle)) * speed,
+                       rng.uniform(1000.0f, 2000.0f), sf::Color::White);
+    }
+}
+
+void BM_ParticleUpdate(benchmark::State& state) {
+    ParticleSystem particles;
+    fill(particles, static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        particles.update(1.0f / 60.0f);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParticleUpdate)->RangeMultiplier(4)->Range(1 << 14, 1 << 20)->Unit(benchmark::kMicrosecond);
+
+void BM_ParticleDraw(benchmark::State& state) {
+    ParticleSystem particles;
+    fill(particles, static_cast<size_t>(state.range(0)));
+    RenderCommandList commands;
+
+    for (auto _ : state) {
+        commands.clear();
+        particles.draw(commands);
+        benchmark::DoNotOptimize(commands.vertices().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ParticleDraw)->RangeMultiplier(4)->Range(1 << 14, 1 << 20)->Unit(benchmark::kMicrosecond);
+
+// One frame's particle work at the 200k target, against a 16.7 ms budget
+void BM_ParticleFrame200k(benchmark::State& state) {
+    ParticleSystem particles;
+    fill(particles, 200000);
+    RenderCommandList commands;
+
+    for (auto _ : state) {
+        particles.update(1.0f / 60.0f);
+        commands.clear();
+        particles.draw(commands);
+        benchmark::DoNotOptimize(commands.vertices().data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(particles.size()));
+}
+BENCHMARK(BM_ParticleFrame200k)->Unit(benchmark::kMillisecond);
+
+} // namespace
@@ -0,0 +1,36 @@
+// benchmarks/RandomBench.cpp
+#include <benchmark/benchmark.h>
+#include <random>
+#include "Random.hpp"
+
+namespace {
+
+// What the split path used to pay per call: a fresh random_device-seeded engine
+void BM_RandomDeviceSeededFloat(benchmark::State& state) {
+    for (auto _ : state) {
+        std::random_device rd;
+        std::mt19937 gen(rd());
+        std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+        benchmark::DoNotOptimize(dist(gen));
+    }
+}
+BENCHMARK(BM_RandomDeviceSeededFloat);
+
+void BM_Mt19937Float(benchmark::State& state) {
+    std::mt19937 gen(1);
+    std::uniform_real_distribution<float> dist(0.0f, 1.0f);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dist(gen));
+    }
+}
+BENCHMARK(BM_Mt19937Float);
+
+void BM_RandomFloat(benchmark::State& state) {
+    Random rng(1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(rng.uniform(0.0f, 1.0f));
+    }
+}
+BENCHMARK(BM_RandomFloat);
+
+} // namespace
@@ -0,0 +1,353 @@
+// benchmarks/SimulationBench.cpp
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <random>
+#include <vector>
+#include "GameState.hpp"
+#include "HeadlessRenderer.hpp"
+
+// Reaches into GameState for the private hot paths
+class GameStateBenchmark {
+public:
+    // Replace the asteroids with count small ones spread over the screen,
+    // keeping clear of the ship so it survives the collision pass. Each of
+    // largeAt also gets a large asteroid, with the small ones kept clear so
+    // nothing else competes for a bullet placed there.
+    static void populate(GameState& state, int64_t count,
+                         const std::vector<sf::Vector2f>& largeAt = {}) {
+        std::mt19937 gen(7);
+        std::uniform_real_distribution<float> xDist(0.0f, WINDOW_WIDTH);
+        std::uniform_real_distribution<float> yDist(0.0f, WINDOW_HEIGHT);
+        std::uniform_real_distribution<float> speedDist(-ASTEROID_MAX_SPEED, ASTEROID_MAX_SPEED);
+        sf::Vector2f center(WINDOW_WIDTH / 2.0f, WINDOW_HEIGHT / 2.0f);
+        const float largeClearance = Asteroid::getRadius(Asteroid::Size::Large) + 20.0f;
+        auto blocked = [&](const sf::Vector2f& pos) {
+            if (std::hypot(pos.x - center.x, pos.y - center.y) < 60.0f) return true;
+            for (const sf::Vector2f& large : largeAt) {
+                if (std::hypot(pos.x - large.x, pos.y - large.y) < largeClearance) return true;
+            }
+            return false;
+        };
+
+        state.asteroidManager.clear();
+        for (int64_t i = 0; i < count; ++i) {
+            sf::Vector2f pos;
+            do {
+                pos = sf::Vector2f(xDist(gen), yDist(gen));
+            } while (blocked(pos));
+
+            Asteroid* asteroid = state.asteroidManager.spawn(Asteroid::Size::Small);
+            asteroid->setPosition(pos);
+            asteroid->setVelocity(sf::Vector2f(speedDist(gen), speedDist(gen)));
+        }
+        for (const sf::Vector2f& pos : largeAt) {
+            state.asteroidManager.spawn(Asteroid::Size::Large)->setPosition(pos);
+        }
+        state.asteroidManager.update(0.0f);
+    }
+
+    static void checkCollisions(GameState& state) { state.checkCollisions(); }
+    static void buildAsteroidGrid(GameState& state) { state.buildAsteroidGrid(); }
+
+    static void spawnSmallerAsteroids(GameState& state, const Asteroid& original) {
+        state.spawnSmallerAsteroids(original);
+    }
+
+    static void clearAsteroids(GameState& state) { state.asteroidManager.clear(); }
+};
+
+namespace {
+
+const sf::Vector2f SCREEN_CENTER(WINDOW_WIDTH / 2.0f, WINDOW_HEIGHT / 2.0f);
+
+void fillManager(GameObjectManager<Asteroid>& manager, int64_t count) {
+    std::mt19937 gen(11);
+    std::uniform_real_distribution<float> xDist(0.0f, WINDOW_WIDTH);
+    std::uniform_real_distribution<float> yDist(0.0f, WINDOW_HEIGHT);
+    for (int64_t i = 0; i < count; ++i) {
+        Asteroid* asteroid = manager.spawn(Asteroid::Size::Medium);
+        asteroid->setPosition(sf::Vector2f(xDist(gen), yDist(gen)));
+        asteroid->setVelocity(sf::Vector2f(30.0f, -40.0f));
+    }
+    manager.update(0.0f);
+}
+
+void BM_ManagerUpdate(benchmark::State& state) {
+    GameObjectManager<Asteroid> manager;
+    fillManager(manager, state.range(0));
+
+    for (auto _ : state) {
+        manager.update(1.0f / 60.0f);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ManagerUpdate)->RangeMultiplier(8)->Range(8, 1 << 18);
+
+// One removeIf pass that removes every tenth object; refilled untimed
+void BM_ManagerRemoveIf(benchmark::State& state) {
+    GameObjectManager<Asteroid> manager;
+    fillManager(manager, state.range(0));
+
+    for (auto _ : state) {
+        size_t index = 0;
+        manager.removeIf([&index](const Asteroid&) { return index++ % 10 == 0; });
+
+        state.PauseTiming();
+        manager.clear();
+        fillManager(manager, state.range(0));
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ManagerRemoveIf)->RangeMultiplier(8)->Range(64, 1 << 18);
+
+// Mark range(1) evenly spread objects out of range(0), then one compaction.
+// Cost should track N, not the number of hits.
+void BM_ManagerMarkCompact(benchmark::State& state) {
+    const int64_t count = state.range(0);
+    const int64_t hits = state.range(1);
+    GameObjectManager<Asteroid> manager;
+    fillManager(manager, count);
+
+    for (auto _ : state) {
+        for (int64_t i = 0; i < hits; ++i) {
+            manager.markForRemoval(static_cast<size_t>(i * count / hits));
+        }
+        manager.compact();
+
+        state.PauseTiming();
+        manager.clear();
+        fillManager(manager, count);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ManagerMarkCompact)->ArgsProduct({{1 << 10, 1 << 14}, {1, 16, 256}});
+
+// The old per-hit path for comparison: one removeIf pass per hit, O(hits * N)
+void BM_ManagerRemoveIfPerHit(benchmark::State& state) {
+    const int64_t count = state.range(0);
+    const int64_t hits = state.range(1);
+    GameObjectManager<Asteroid> manager;
+    fillManager(manager, count);
+
+    for (auto _ : state) {
+        for (int64_t i = 0; i < hits; ++i) {
+            const Asteroid* target = manager.getObjects()[static_cast<size_t>(i * (count - i) / hits)].get();
+            manager.removeIf([target](const Asteroid& a) { return &a == target; });
+        }
+
+        state.PauseTiming();
+        manager.clear();
+        fillManager(manager, count);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * count);
+}
+BENCHMARK(BM_ManagerRemoveIfPerHit)->ArgsProduct({{1 << 10, 1 << 14}, {1, 16, 256}});
+
+// Spawn count bullets from the pool, fold them in, then recycle them all
+void BM_ManagerSpawn(benchmark::State& state) {
+    GameObjectManager<Bullet> manager;
+
+    for (auto _ : state) {
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            manager.spawn(SCREEN_CENTER, static_cast<float>(i));
+        }
+        manager.update(0.0f);
+        manager.clear();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ManagerSpawn)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+void BM_AsteroidUpdate(benchmark::State& state) {
+    std::vector<std::unique_ptr<GameObject>> asteroids;
+    for (int64_t i = 0; i < state.range(0); ++i) {
+        auto asteroid = std::make_unique<Asteroid>(Asteroid::Size::Large);
+        asteroid->setPosition(SCREEN_CENTER);
+        asteroid->setVelocity(sf::Vector2f(50.0f, 25.0f));
+        asteroids.push_back(std::move(asteroid));
+    }
+
+    for (auto _ : state) {
+        for (auto& asteroid : asteroids) {
+            asteroid->update(1.0f / 60.0f);
+        }
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_AsteroidUpdate)->RangeMultiplier(8)->Range(8, 1 << 18);
+
+// Construction cost alone, shape included
+void BM_AsteroidConstruct(benchmark::State& state) {
+    Random rng(3);
+    for (auto _ : state) {
+        Asteroid asteroid(Asteroid::Size::Large, rng);
+        benchmark::DoNotOptimize(&asteroid);
+    }
+}
+BENCHMARK(BM_AsteroidConstruct);
+
+// Collision pass with a full magazine of bullets in flight. All but one
+// bullet sit on a large asteroid, so every pass scores, splits and spawns;
+// the world is restored from a snapshot between passes so each one starts
+// the same.
+void BM_CheckCollisions(benchmark::State& state) {
+    std::vector<sf::Vector2f> targets;
+    for (int i = 0; i + 1 < MAX_BULLETS; ++i) {
+        targets.push_back(SCREEN_CENTER + sf::Vector2f(vec2::fromAngle(i * 1.6f) * 200.0f));
+    }
+    GameState gameState;
+    GameStateBenchmark::populate(gameState, state.range(0), targets);
+
+    Ship* ship = gameState.getShip();
+    for (int i = 0; i < MAX_BULLETS; ++i) {
+        const sf::Vector2f position = i < static_cast<int>(targets.size()) ? targets[i] : SCREEN_CENTER;
+        ship->getBulletManager().spawn(position, i * 72.0f);
+    }
+    ship->getBulletManager().update(0.0f);
+
+    std::vector<uint8_t> start;
+    gameState.saveSnapshot(start);
+    int points = 0;
+    for (auto _ : state) {
+        GameStateBenchmark::checkCollisions(gameState);
+
+        state.PauseTiming();
+        points = gameState.getScore();
+        gameState.restoreSnapshot(start);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["points"] = points;  // Scored per pass; 0 means nothing was hit
+}
+BENCHMARK(BM_CheckCollisions)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+// Bullet-hell collision pass: 1024 bullets scattered over 16k asteroids,
+// with range(0) threads. Wall time should fall with threads up to the core
+// count; the serial merge is all that is left on one thread.
+void BM_CheckCollisionsThreads(benchmark::State& state) {
+    GameState gameState;
+    GameStateBenchmark::populate(gameState, 1 << 14);
+    ThreadPool pool(static_cast<size_t>(state.range(0)));
+    gameState.setThreadPool(&pool);
+
+    std::mt19937 gen(13);
+    std::uniform_real_distribution<float> xDist(0.0f, WINDOW_WIDTH);
+    std::uniform_real_distribution<float> yDist(0.0f, WINDOW_HEIGHT);
+    auto& bullets = gameState.getShip()->getBulletManager();
+    for (int i = 0; i < 1024; ++i) {
+        sf::Vector2f pos(xDist(gen), yDist(gen));
+        if (std::hypot(pos.x - SCREEN_CENTER.x, pos.y - SCREEN_CENTER.y) < 60.0f) continue;
+        bullets.spawn(pos, i * 7.0f);
+    }
+    bullets.update(0.0f);
+
+    for (auto _ : state) {
+        GameStateBenchmark::checkCollisions(gameState);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(bullets.count()));
+}
+BENCHMARK(BM_CheckCollisionsThreads)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+
+// Grid rebuild over the 100k preset with range(0) threads: the part of the
+// collision phase that grows with the asteroid count. Staging should scale
+// with cores; the serial counting sort bounds the speedup.
+void BM_BuildAsteroidGridThreads(benchmark::State& state) {
+    auto config = std::make_shared<const WorldConfig>(WorldConfig::preset("100k"));
+    GameState gameState(nullptr, 1, config);
+    gameState.update(0.0f);  // Activates the field
+    ThreadPool pool(static_cast<size_t>(state.range(0)));
+    gameState.setThreadPool(&pool);
+
+    for (auto _ : state) {
+        GameStateBenchmark::buildAsteroidGrid(gameState);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(gameState.getAsteroidCount()));
+}
+BENCHMARK(BM_BuildAsteroidGridThreads)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+
+void BM_SpawnSmallerAsteroids(benchmark::State& state) {
+    GameState gameState;
+    Asteroid original(Asteroid::Size::Large);
+    original.setPosition(SCREEN_CENTER);
+    original.setVelocity(sf::Vector2f(60.0f, -20.0f));
+
+    for (auto _ : state) {
+        for (int64_t i = 0; i < state.range(0); ++i) {
+            GameStateBenchmark::spawnSmallerAsteroids(gameState, original);
+        }
+
+        state.PauseTiming();
+        GameStateBenchmark::clearAsteroids(gameState);
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SpawnSmallerAsteroids)->RangeMultiplier(8)->Range(8, 1 << 12);
+
+// Snapshot cost at range(0) asteroids
+void BM_SnapshotSave(benchmark::State& state) {
+    GameState gameState;
+    GameStateBenchmark::populate(gameState, state.range(0));
+    std::vector<uint8_t> snapshot;
+
+    for (auto _ : state) {
+        gameState.saveSnapshot(snapshot);
+        benchmark::DoNotOptimize(snapshot.data());
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(snapshot.size()));
+    state.counters["bytes"] = static_cast<double>(snapshot.size());
+}
+BENCHMARK(BM_SnapshotSave)->RangeMultiplier(10)->Range(100, 10000);
+
+void BM_SnapshotRestore(benchmark::State& state) {
+    GameState gameState;
+    GameStateBenchmark::populate(gameState, state.range(0));
+    std::vector<uint8_t> snapshot;
+    gameState.saveSnapshot(snapshot);
+
+    for (auto _ : state) {
+        gameState.restoreSnapshot(snapshot);
+        benchmark::ClobberMemory();
+    }
+    state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(snapshot.size()));
+}
+BENCHMARK(BM_SnapshotRestore)->RangeMultiplier(10)->Range(100, 10000);
+
+// Draw preparation without a window: snapshot, interpolate and record commands
+void BM_RecordFrame(benchmark::State& state) {
+    GameState gameState;
+    GameStateBenchmark::populate(gameState, state.range(0));
+    RenderCommandList commands;
+
+    for (auto _ : state) {
+        commands.clear();
+        gameState.draw(commands, 0.5f);
+        benchmark::DoNotOptimize(commands.points().data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+    state.counters["commands"] = static_cast<double>(commands.commands().size());
+}
+BENCHMARK(BM_RecordFrame)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+// Counting and hashing a recorded frame, as a headless regression check would
+void BM_HeadlessSubmit(benchmark::State& state) {
+    GameState gameState;
+    GameStateBenchmark::populate(gameState, state.range(0));
+    RenderCommandList commands;
+    gameState.draw(commands, 0.5f);
+    HeadlessRenderer headless;
+
+    for (auto _ : state) {
+        headless.submit(commands);
+        benchmark::DoNotOptimize(headless.lastFrameHash());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_HeadlessSubmit)->RangeMultiplier(8)->Range(8, 1 << 15);
+
+} // namespace
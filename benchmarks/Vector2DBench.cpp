@@ -0,0 +1,51 @@
+// benchmarks/Vector2DBench.cpp
+#include <benchmark/benchmark.h>
+#include <vector>
+#include "Random.hpp"
+#include "Vector2D.hpp"
+
+namespace {
+
+// Velocities around the ship's top speed
+struct Soa {
+    std::vector<float> x, y;
+
+    explicit Soa(size_t count) : x(count), y(count) {
+        Random rng(42);
+        for (size_t i = 0; i < count; ++i) {
+            x[i] = rng.uniform(-400.0f, 400.0f);
+            y[i] = rng.uniform(-400.0f, 400.0f);
+        }
+    }
+};
+
+template<void (*Kernel)(float*, float*, const float*, const float*, size_t, float)>
+void BM_Integrate(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    Soa positions(count);
+    Soa velocities(count);
+    for (auto _ : state) {
+        Kernel(positions.x.data(), positions.y.data(), velocities.x.data(), velocities.y.data(),
+               count, 1.0f / 60.0f);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_Integrate, vec2::integrate)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_Integrate, vec2::scalar::integrate)->Range(1 << 10, 1 << 20);
+
+template<void (*Kernel)(const float*, const float*, float*, size_t)>
+void BM_LengthsSq(benchmark::State& state) {
+    const size_t count = static_cast<size_t>(state.range(0));
+    Soa vectors(count);
+    std::vector<float> out(count);
+    for (auto _ : state) {
+        Kernel(vectors.x.data(), vectors.y.data(), out.data(), count);
+        benchmark::ClobberMemory();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK_TEMPLATE(BM_LengthsSq, vec2::lengthsSq)->Range(1 << 10, 1 << 20);
+BENCHMARK_TEMPLATE(BM_LengthsSq, vec2::scalar::lengthsSq)->Range(1 << 10, 1 << 20);
+
+} // namespace
@@ -0,0 +1,31 @@
+// benchmarks/WorldBatchBench.cpp
+#include <benchmark/benchmark.h>
+#include "WorldBatch.hpp"
+
+namespace {
+
+std::unique_ptr<InputSource> firingPilot(size_t) {
+    std::vector<InputState> script(60);
+    for (size_t i = 0; i < script.size(); ++i) {
+        script[i].rotateRight = true;
+        script[i].fire = i % 6 < 3;
+        script[i].restart = true;
+    }
+    return std::make_unique<ScriptedInput>(script);
+}
+
+// 256 worlds x 100 ticks per iteration on range(0) threads. Wall-clock
+// ticks/second should grow linearly with threads up to the core count.
+void BM_WorldBatchStep(benchmark::State& state) {
+    const long ticks = 100;
+    WorldBatch batch(256, 42, firingPilot);
+    ThreadPool pool(static_cast<size_t>(state.range(0)));
+
+    for (auto _ : state) {
+        batch.step(pool, ticks, 1.0f / 60.0f);
+    }
+    state.SetItemsProcessed(state.iterations() * ticks * static_cast<int64_t>(batch.size()));
+}
+BENCHMARK(BM_WorldBatchStep)->RangeMultiplier(2)->Range(1, 16)->UseRealTime();
+
+} // namespace
@@ -1,41 +1,96 @@
 // include/Asteroid.hpp
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <array>
+#include <cstdint>
 #include <random>
-#include <cmath>
 #include "GameObject.hpp"
 #include "Constants.hpp"
+#include "Random.hpp"
 
-class Asteroid : public GameObject {
+class Asteroid final : public GameObject {
 public:
     enum class Size { Small, Medium, Large };
+
+    // Most outline vertices any asteroid can have (large ones use 10-12)
+    static constexpr size_t MAX_POINTS = 12;
+
+    // Outline templates precomputed per size; asteroids pick one by index
+    static constexpr uint16_t SHAPES_PER_SIZE = 16;
+
+    // Outline in local space (unrotated, centred on the origin)
+    struct Shape {
+        uint8_t pointCount;
+        std::array<sf::Vector2f, MAX_POINTS> points;
+    };
+
+    // Shared template library, built once from a fixed seed on first use
+    static const Shape& getShape(Size size, uint16_t index);
+
+    // Everything needed to recreate an asteroid, plain data for snapshots
+    struct State {
+        Body body;
+        float rotation;
+        float previousRotation;
+        float rotationSpeed;
+        Size size;
+        uint16_t shapeIndex;
+        uint16_t reserved;          // Keeps the layout free of padding
+    };
     
-    explicit Asteroid(Size size) : size(size) {
-        generateShape();
-        generateRotationSpeed();
+    // Shape and spin are drawn from rng, so a world that owns its generator
+    // never touches state shared with other worlds. config, which must outlive
+    // the asteroid, gives the world it wraps around.
+    Asteroid(Size size, Random& rng, const WorldConfig& config = WorldConfig::defaults())
+        : size(size), shapeIndex(static_cast<uint16_t>(rng.range(0, SHAPES_PER_SIZE - 1))) {
+        this->config = &config;
+        generateRotationSpeed(rng);
+    }
+
+    explicit Asteroid(Size size) : Asteroid(size, defaultGenerator()) {}
+
+    explicit Asteroid(const State& state, const WorldConfig& config = WorldConfig::defaults())
+        : size(state.size), shapeIndex(state.shapeIndex), rotationSpeed(state.rotationSpeed),
+          currentRotation(state.rotation), previousRotation(state.previousRotation) {
+        this->config = &config;
+        setBody(state.body);
+    }
+
+    State getState() const {
+        return State{getBody(), currentRotation, previousRotation, rotationSpeed, size, shapeIndex, 0};
     }
     
     void update(float deltaTime) override {
+        savePreviousState();
+        previousRotation = currentRotation;
+
         // Update position based on velocity
         position += velocity * deltaTime;
         
         // Update rotation
         currentRotation += rotationSpeed * deltaTime;
-        shape.setRotation(currentRotation);
-        
-        // Wrap around screen edges
-        wrapPosition(WINDOW_WIDTH, WINDOW_HEIGHT);
         
-        // Update shape position
-        shape.setPosition(position);
+        // Wrap around the world's edges
+        wrapPosition();
     }
     
-    void draw(sf::RenderWindow& window) override {
-        window.draw(shape);
+    void draw(RenderCommandList& commands, float alpha) override {
+        drawShape(commands, size, shapeIndex, getInterpolatedPosition(alpha),
+                  lerp(previousRotation, currentRotation, alpha));
+    }
+
+    // Also used to draw asteroids from render snapshots
+    static void drawShape(RenderCommandList& commands, Size size, uint16_t shapeIndex,
+                          const sf::Vector2f& position, float rotation) {
+        const Shape& shape = getShape(size, shapeIndex);
+        commands.addOutline(shape.points.data(), shape.pointCount, position, rotation,
+                         sf::Color::White);
     }
     
     // Get the collision radius based on asteroid size
-    float getRadius() const {
+    float getRadius() const { return getRadius(size); }
+
+    static float getRadius(Size size) {
         switch (size) {
             case Size::Large: return LARGE_ASTEROID_RADIUS * ASTEROID_SCALE;
             case Size::Medium: return MEDIUM_ASTEROID_RADIUS * ASTEROID_SCALE;
@@ -45,58 +100,41 @@ public:
     }
 
     Size getSize() const { return size; }
+    float getRotation() const { return currentRotation; }
+    float getRotationSpeed() const { return rotationSpeed; }
+
+    const Shape& getShape() const { return getShape(size, shapeIndex); }
+    uint16_t getShapeIndex() const { return shapeIndex; }
+
+    // Outline vertices in local space (unrotated, centred on the origin)
+    size_t getPointCount() const { return getShape().pointCount; }
+    sf::Vector2f getPoint(size_t index) const { return getShape().points[index]; }
 
 private:
-    void generateShape() {
-        // Get radius based on size
-        float radius = getRadius();
-        float scale = ASTEROID_SCALE;
-        
-        // Generate random number of vertices based on size
-        int minVertices = (size == Size::Small) ? 6 : (size == Size::Medium) ? 8 : 10;
-        int maxVertices = (size == Size::Small) ? 8 : (size == Size::Medium) ? 10 : 12;
-        int vertices = minVertices + (rand() % (maxVertices - minVertices + 1));
-        
-        shape.setPointCount(vertices);
-        
-        // Generate random points around a circle
-        for (int i = 0; i < vertices; ++i) {
-            float angle = (i * 2 * M_PI) / vertices;
-            
-            // Add some randomness to the radius (between 80% and 120% of base radius)
-            float radiusVariation = radius * (0.8f + (static_cast<float>(rand()) / RAND_MAX) * 0.4f);
-            
-            float x = std::cos(angle) * radiusVariation * scale;
-            float y = std::sin(angle) * radiusVariation * scale;
-            
-            shape.setPoint(i, sf::Vector2f(x, y));
-        }
-        
-        // Set appearance
-        shape.setFillColor(sf::Color::Transparent);
-        shape.setOutlineColor(sf::Color::White);
-        shape.setOutlineThickness(1.0f);
-        shape.setOrigin(0, 0);
+    static Random& defaultGenerator() {
+        thread_local Random gen(std::random_device{}());
+        return gen;
     }
-    
-    void generateRotationSpeed() {
+
+    void generateRotationSpeed(Random& rng) {
         // Base rotation speed depends on size (smaller asteroids rotate faster)
         float baseSpeed = (size == Size::Large) ? 30.0f :
                          (size == Size::Medium) ? 45.0f :
                                                 60.0f;
         
         // Add random variation (±50%)
-        float variation = (static_cast<float>(rand()) / RAND_MAX - 0.5f) * baseSpeed;
+        float variation = rng.uniform(-0.5f, 0.5f) * baseSpeed;
         rotationSpeed = baseSpeed + variation;
         
         // Randomly reverse rotation direction
-        if (rand() % 2 == 0) {
+        if (rng.coinFlip()) {
             rotationSpeed = -rotationSpeed;
         }
     }
     
-    const Size size;
-    sf::ConvexShape shape;
+    Size size;                  // Not const so EntityStore can move asteroids
+    uint16_t shapeIndex;        // Into getShape(size, ...), drawn white and unfilled
     float rotationSpeed;        // Degrees per second
     float currentRotation = 0;  // Current rotation in degrees
+    float previousRotation = 0; // Rotation before the last update
 };
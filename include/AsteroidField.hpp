@@ -0,0 +1,70 @@
+// include/AsteroidField.hpp
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <vector>
+#include "Asteroid.hpp"
+#include "RenderCommandList.hpp"
+#include "Constants.hpp"
+
+// Structure-of-arrays asteroid storage for very large asteroid counts.
+//
+// Physics state lives in parallel arrays integrated by one batch kernel that
+// the compiler can vectorise. Outlines are shared Asteroid shape templates,
+// referenced by index from a separate array the update loop never touches.
+//
+// Standalone: GameState keeps its asteroids as pooled Asteroid objects,
+// because the broadphase grid, splitting, snapshots and environment
+// observations all address them by pointer and id. The field keeps no
+// previous positions, so it can't be drawn interpolated either. It serves
+// bulk scenery and as the measured baseline for the per-object path.
+class AsteroidField {
+public:
+    explicit AsteroidField(float worldWidth = WINDOW_WIDTH, float worldHeight = WINDOW_HEIGHT)
+        : worldWidth(worldWidth), worldHeight(worldHeight) {}
+
+    // Copy an asteroid's state and shape index into the field, returns its index
+    size_t add(const Asteroid& asteroid);
+
+    // Remove by moving the last asteroid into the hole, O(1)
+    void removeSwap(size_t index);
+
+    void clear();
+    void reserve(size_t count);
+
+    // Integrate positions and rotations, then wrap at the world edges
+    void update(float deltaTime);
+
+    void draw(RenderCommandList& commands) const;
+
+    size_t size() const { return positionX.size(); }
+    bool empty() const { return positionX.empty(); }
+
+    sf::Vector2f getPosition(size_t i) const { return sf::Vector2f(positionX[i], positionY[i]); }
+    sf::Vector2f getVelocity(size_t i) const { return sf::Vector2f(velocityX[i], velocityY[i]); }
+    float getRotation(size_t i) const { return rotation[i]; }
+    float getRotationSpeed(size_t i) const { return rotationSpeed[i]; }
+    float getRadius(size_t i) const { return radius[i]; }
+    Asteroid::Size getSize(size_t i) const { return static_cast<Asteroid::Size>(size_[i]); }
+    uint16_t getShapeIndex(size_t i) const { return shapeIndex[i]; }
+
+    void setPosition(size_t i, const sf::Vector2f& pos) { positionX[i] = pos.x; positionY[i] = pos.y; }
+    void setVelocity(size_t i, const sf::Vector2f& vel) { velocityX[i] = vel.x; velocityY[i] = vel.y; }
+
+private:
+    float worldWidth;
+    float worldHeight;
+
+    // Hot physics state, one entry per asteroid
+    std::vector<float> positionX;
+    std::vector<float> positionY;
+    std::vector<float> velocityX;
+    std::vector<float> velocityY;
+    std::vector<float> rotation;        // Degrees
+    std::vector<float> rotationSpeed;   // Degrees per second
+    std::vector<float> radius;
+    std::vector<uint8_t> size_;
+
+    // Cold render data: template within Asteroid::getShape(size, index)
+    std::vector<uint16_t> shapeIndex;
+};
@@ -0,0 +1,68 @@
+/* include/AsteroidsEnv.h */
+#ifndef ASTEROIDS_ENV_H
+#define ASTEROIDS_ENV_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* C interface to EnvBatch, for training code in other languages (Python
+ * through ctypes or cffi, for example). Built as the asteroids_env shared
+ * library. Output pointers stay owned by the environment and are valid
+ * until its next reset, step or destroy; a caller can wrap them as arrays
+ * without copying. See EnvBatch.hpp for the observation layout. */
+
+/* Only these functions are exported; the game code linked into the
+ * library stays hidden so it cannot clash with another copy in the host */
+#if defined(_WIN32)
+#  ifdef ASTEROIDS_ENV_BUILD
+#    define ASTEROIDS_ENV_API __declspec(dllexport)
+#  else
+#    define ASTEROIDS_ENV_API __declspec(dllimport)
+#  endif
+#else
+#  define ASTEROIDS_ENV_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct AsteroidsEnv AsteroidsEnv;
+
+/* Action bits, one byte per environment */
+#define ASTEROIDS_ACTION_ROTATE_LEFT  1
+#define ASTEROIDS_ACTION_ROTATE_RIGHT 2
+#define ASTEROIDS_ACTION_THRUST       4
+#define ASTEROIDS_ACTION_FIRE         8
+
+/* env_count worlds of a preset (NULL for classic) stepped on threads
+ * threads (0 for one per core). Default sensors: 8 nearest asteroids, 16
+ * rays reaching 400 pixels, one tick per step. Returns NULL on failure;
+ * asteroids_env_last_error() says why. */
+ASTEROIDS_ENV_API AsteroidsEnv* asteroids_env_create(size_t env_count, uint32_t seed,
+                                                     const char* preset, size_t threads);
+ASTEROIDS_ENV_API void asteroids_env_destroy(AsteroidsEnv* env);
+
+/* Message for the last failed call on this thread, or "" */
+ASTEROIDS_ENV_API const char* asteroids_env_last_error(void);
+
+ASTEROIDS_ENV_API size_t asteroids_env_count(const AsteroidsEnv* env);
+ASTEROIDS_ENV_API size_t asteroids_env_observation_size(const AsteroidsEnv* env);
+
+/* Both return 0 on success and -1 on failure, such as running out of
+ * memory restarting an episode; asteroids_env_last_error() says why. After
+ * a failure the outputs are unspecified until a successful reset. */
+ASTEROIDS_ENV_API int asteroids_env_reset(AsteroidsEnv* env);
+/* actions holds asteroids_env_count() bytes */
+ASTEROIDS_ENV_API int asteroids_env_step(AsteroidsEnv* env, const uint8_t* actions);
+
+/* count x observation_size floats, row-major */
+ASTEROIDS_ENV_API const float* asteroids_env_observations(const AsteroidsEnv* env);
+ASTEROIDS_ENV_API const float* asteroids_env_rewards(const AsteroidsEnv* env);
+ASTEROIDS_ENV_API const uint8_t* asteroids_env_dones(const AsteroidsEnv* env);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ASTEROIDS_ENV_H */
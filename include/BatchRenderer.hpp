@@ -0,0 +1,63 @@
+// include/BatchRenderer.hpp
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <string>
+#include <vector>
+#include "Constants.hpp"
+#include "RenderCommandList.hpp"
+
+// SFML backend for RenderCommandList. Collects a frame's geometry into one
+// vertex array per material and submits each with a single draw call, then
+// draws the text runs. Lines commands, which carry their own vertices, are
+// drawn in place with one call each. Arrays are cleared, not freed, between frames so
+// steady-state frames do not allocate, and each text run keeps its sf::Text,
+// re-laid out only when its string or style changes.
+//
+// Geometry is in world coordinates and text in HUD coordinates, a fixed
+// WINDOW_WIDTH x WINDOW_HEIGHT space. Each is scaled to fit the target with
+// its aspect ratio kept, so any world size fills any window.
+class BatchRenderer {
+public:
+    // The font must outlive the renderer. Without one, text runs are skipped.
+    void setFont(const sf::Font& newFont);
+
+    // Size of the world the geometry lives in; the classic 800x600 by default
+    void setWorldSize(const sf::Vector2f& size) { worldSize = size; }
+
+    // Draw a whole frame. Leaves the HUD view set on target, so overlays
+    // drawn afterwards can use HUD coordinates too.
+    void submit(const RenderCommandList& commands, sf::RenderTarget& target);
+
+    // View showing all of area, centred, widened along one axis to match
+    // the target's aspect ratio
+    static sf::View fitView(const sf::Vector2f& area, const sf::Vector2u& targetSize);
+
+    // Draw calls issued by the last submit()
+    int getDrawCalls() const { return drawCalls; }
+    size_t getVertexCount() const { return lines.getVertexCount() + triangles.getVertexCount(); }
+    // Text runs re-laid out by the last submit(), 0 when every string held still
+    int getTextRebuilds() const { return textRebuilds; }
+
+    static constexpr size_t CIRCLE_SEGMENTS = 8;
+
+private:
+    struct TextRun {
+        sf::Text text;
+        std::string shown;
+        unsigned characterSize = 0;
+        bool centered = false;
+    };
+
+    void appendGeometry(const RenderCommandList& commands);
+    void drawVertexLines(const RenderCommandList& commands, sf::RenderTarget& target);
+    void drawText(const RenderCommandList& commands, sf::RenderTarget& target);
+
+    sf::VertexArray lines{sf::Lines};
+    sf::VertexArray triangles{sf::Triangles};
+    const sf::Font* font = nullptr;
+    sf::Vector2f worldSize{WINDOW_WIDTH, WINDOW_HEIGHT};
+    std::vector<TextRun> textRuns;
+    int drawCalls = 0;
+    int textRebuilds = 0;
+};
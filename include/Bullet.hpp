@@ -3,63 +3,75 @@
 #include <SFML/Graphics.hpp>
 #include "GameObject.hpp"
 #include "Constants.hpp"
+#include "Vector2D.hpp"
 
-class Bullet : public GameObject {
+class Bullet final : public GameObject {
 public:
-    Bullet(const sf::Vector2f& startPos, float rotation) {
-        position = startPos;
-        
-        // Convert rotation to radians for direction calculation
-        float rotationRad = rotation * M_PI / 180.0f;
-        
-        // Calculate velocity based on rotation
-        velocity = sf::Vector2f(
-            std::sin(rotationRad) * BULLET_SPEED,
-            -std::cos(rotationRad) * BULLET_SPEED  // Negative because y-axis is down in SFML
-        );
+    // Everything needed to recreate a bullet, plain data for snapshots
+    struct State {
+        Body body;
+        float distanceTraveled;
+        float maxDistance;
+    };
+
+    // Speed and range come from config, which must outlive the bullet
+    Bullet(const sf::Vector2f& startPos, float rotation,
+           const WorldConfig& config = WorldConfig::defaults()) {
+        this->config = &config;
+        setPosition(startPos);
         
-        // Initialize the shape
-        shape.setRadius(2.0f);
-        shape.setFillColor(sf::Color::White);
-        shape.setOrigin(2.0f, 2.0f);  // Center the origin
-        shape.setPosition(position);
+        // Fly the way the ship faced
+        velocity = vec2::heading(rotation) * config.bulletSpeed;
         
         // Calculate distance this bullet can travel
-        float shortestAxis = std::min(WINDOW_WIDTH, WINDOW_HEIGHT);
-        maxDistance = shortestAxis * 0.75f;  // Bullet travels 75% of shortest screen dimension
+        float shortestAxis = std::min(config.width, config.height);
+        maxDistance = shortestAxis * 0.75f;  // Bullet travels 75% of shortest world dimension
     }
     
+    explicit Bullet(const State& state, const WorldConfig& config = WorldConfig::defaults())
+        : distanceTraveled(state.distanceTraveled), maxDistance(state.maxDistance) {
+        this->config = &config;
+        setBody(state.body);
+    }
+
+    State getState() const { return State{getBody(), distanceTraveled, maxDistance}; }
+    
     void update(float deltaTime) override {
+        savePreviousState();
+
         // Update position based on velocity
         position += velocity * deltaTime;
-        shape.setPosition(position);
         
         // Update total distance traveled
-        float movement = BULLET_SPEED * deltaTime;
+        float movement = config->bulletSpeed * deltaTime;
         distanceTraveled += movement;
     }
     
-    void draw(sf::RenderWindow& window) override {
-        window.draw(shape);
+    void draw(RenderCommandList& commands, float alpha) override {
+        drawAt(commands, getInterpolatedPosition(alpha));
+    }
+
+    // Also used to draw bullets from render snapshots
+    static void drawAt(RenderCommandList& commands, const sf::Vector2f& position) {
+        commands.addCircle(position, RADIUS, sf::Color::White);
     }
     
-    float getRadius() const { return 2.0f; }
+    float getRadius() const { return RADIUS; }
     
     // Returns true if bullet has exceeded its maximum travel distance
     bool hasExpired() const {
         return distanceTraveled >= maxDistance;
     }
     
-    // Returns true if bullet is off screen
+    // Returns true if bullet has left the world
     bool isOffScreen() const {
-        return position.x < 0 || position.x > WINDOW_WIDTH ||
-               position.y < 0 || position.y > WINDOW_HEIGHT;
+        return position.x < 0 || position.x > config->width ||
+               position.y < 0 || position.y > config->height;
     }
 
 private:
-    sf::CircleShape shape;
     float distanceTraveled = 0.0f;
     float maxDistance;
     
-    static constexpr float BULLET_SPEED = 500.0f;  // pixels per second
+    static constexpr float RADIUS = 2.0f;
 };
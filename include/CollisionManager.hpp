@@ -1,29 +1,106 @@
 // include/CollisionManager.hpp
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <cmath>
 #include "Ship.hpp"
 #include "Asteroid.hpp"
 #include "Bullet.hpp"
+#include "Constants.hpp"
+#include "Vector2D.hpp"
 
 class CollisionManager {
 public:
     // Check collision between ship and asteroid
     static bool checkCollision(const Ship& ship, const Asteroid& asteroid) {
-        return getDistance(ship.getPosition(), asteroid.getPosition()) < 
-               (ship.getRadius() + asteroid.getRadius());
+        return circlesOverlap(ship.getPosition(), ship.getRadius(),
+                              asteroid.getPosition(), asteroid.getRadius(),
+                              ship.getConfig().size());
     }
-    
+
     // Check collision between bullet and asteroid
     static bool checkCollision(const Bullet& bullet, const Asteroid& asteroid) {
-        return getDistance(bullet.getPosition(), asteroid.getPosition()) < 
-               (bullet.getRadius() + asteroid.getRadius());
+        return circlesOverlap(bullet.getPosition(), bullet.getRadius(),
+                              asteroid.getPosition(), asteroid.getRadius(),
+                              bullet.getConfig().size());
+    }
+
+    // Swept tests: did the pair touch at any point during the last update?
+    // timeOfImpact is the fraction of the tick, in [0, 1], at first contact.
+    static bool sweep(const Ship& ship, const Asteroid& asteroid, float& timeOfImpact) {
+        return sweptCircles(ship, ship.getRadius(), asteroid, asteroid.getRadius(), timeOfImpact);
+    }
+
+    static bool sweep(const Bullet& bullet, const Asteroid& asteroid, float& timeOfImpact) {
+        return sweptCircles(bullet, bullet.getRadius(), asteroid, asteroid.getRadius(),
+                            timeOfImpact);
+    }
+
+    // How far an object moved during its last update, across world wraps
+    static sf::Vector2f displacement(const GameObject& object) {
+        return wrappedDelta(object.getPreviousPosition(), object.getPosition(),
+                            object.getConfig().size());
+    }
+
+    // Continuous narrowphase: circles starting at p1 and p2 and moving by d1
+    // and d2 over the tick. Solves |p2 - p1 + (d2 - d1)t| = r1 + r2 for the
+    // earliest t in [0, 1], so fast pairs can't tunnel through each other.
+    static bool sweptCirclesHit(const sf::Vector2f& p1, const sf::Vector2f& d1, float r1,
+                                const sf::Vector2f& p2, const sf::Vector2f& d2, float r2,
+                                const sf::Vector2f& world, float& timeOfImpact) {
+        sf::Vector2f start = wrappedDelta(p1, p2, world);
+        sf::Vector2f motion = d2 - d1;
+        float radii = r1 + r2;
+
+        float c = vec2::lengthSq(start) - radii * radii;
+        if (c < 0.0f) {
+            timeOfImpact = 0.0f;
+            return true;
+        }
+
+        float a = vec2::lengthSq(motion);
+        float halfB = vec2::dot(start, motion);
+        if (a <= 0.0f || halfB >= 0.0f) return false;  // Still or moving apart
+
+        float discriminant = halfB * halfB - a * c;
+        if (discriminant <= 0.0f) return false;
+
+        float t = (-halfB - std::sqrt(discriminant)) / a;
+        if (t > 1.0f) return false;
+        timeOfImpact = t;
+        return true;
+    }
+
+    // Narrowphase on a toroidal world: compares squared distances, no sqrt
+    static bool circlesOverlap(const sf::Vector2f& p1, float r1,
+                               const sf::Vector2f& p2, float r2,
+                               const sf::Vector2f& world) {
+        float radii = r1 + r2;
+        return getDistanceSquared(p1, p2, world) < radii * radii;
+    }
+
+    // Shortest vector from p1 to p2 when the screen edges wrap around
+    static sf::Vector2f wrappedDelta(const sf::Vector2f& p1, const sf::Vector2f& p2,
+                                     const sf::Vector2f& world) {
+        return sf::Vector2f(wrapAxis(p2.x - p1.x, world.x), wrapAxis(p2.y - p1.y, world.y));
+    }
+
+    static float getDistanceSquared(const sf::Vector2f& p1, const sf::Vector2f& p2,
+                                    const sf::Vector2f& world) {
+        return vec2::lengthSq(wrappedDelta(p1, p2, world));
     }
 
 private:
-    // Helper function to calculate distance between two points
-    static float getDistance(const sf::Vector2f& p1, const sf::Vector2f& p2) {
-        float dx = p2.x - p1.x;
-        float dy = p2.y - p1.y;
-        return std::sqrt(dx * dx + dy * dy);
+    static bool sweptCircles(const GameObject& first, float firstRadius,
+                             const GameObject& second, float secondRadius,
+                             float& timeOfImpact) {
+        return sweptCirclesHit(first.getPreviousPosition(), displacement(first), firstRadius,
+                               second.getPreviousPosition(), displacement(second), secondRadius,
+                               first.getConfig().size(), timeOfImpact);
+    }
+
+    static float wrapAxis(float d, float extent) {
+        if (d > extent * 0.5f) return d - extent;
+        if (d < -extent * 0.5f) return d + extent;
+        return d;
     }
 };
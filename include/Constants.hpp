@@ -1,17 +1,30 @@
+// Compile-time constants. World size, counts, speeds and tick rate here are
+// only the defaults for WorldConfig, which can change them at run time.
+
 #pragma once
 
-// Window settings
+// Window settings. Also the size of the classic world, and the HUD's
+// coordinate space whatever the real window size.
 inline constexpr int WINDOW_WIDTH = 800;
 inline constexpr int WINDOW_HEIGHT = 600;
 inline constexpr char WINDOW_TITLE[] = "Asteroids";
 inline constexpr char FONT_PATH[] = "assets/fonts/PressStart2P-Regular.ttf";
 
+// Profiler capture output (F4 in game)
+inline constexpr char PROFILE_TRACE_PATH[] = "profile_trace.json";
+inline constexpr char PROFILE_CSV_PATH[] = "profile_events.csv";
+
+// Simulation timing
+inline constexpr float SIMULATION_TICK_RATE = 30.0f;   // fixed physics steps per second
+inline constexpr int MAX_CATCH_UP_STEPS = 8;          // most steps simulated in one frame
+
 // Physics/movement
 inline constexpr float SHIP_ROTATION_SPEED = 180.0f;  // degrees per second
 inline constexpr float SHIP_ACCELERATION = 300.0f;     // pixels per second^2
 inline constexpr float SHIP_MAX_SPEED = 400.0f;       // pixels per second
 inline constexpr float DRAG_COEFFICIENT = 1.00;      // velocity multiplier per frame
 inline constexpr float SHIP_SCALE = 0.5f;
+inline constexpr float BULLET_SPEED = 500.0f;        // pixels per second
 
 // Asteroid settings
 inline constexpr float LARGE_ASTEROID_RADIUS = 40.0f;
@@ -21,6 +34,7 @@ inline constexpr int INITIAL_ASTEROID_COUNT = 4;
 inline constexpr float ASTEROID_MIN_SPEED = 50.0f;  // pixels per second
 inline constexpr float ASTEROID_MAX_SPEED = 100.0f;  // pixels per second
 inline constexpr float ASTEROID_SCALE = 1.0f;
+inline constexpr float ASTEROID_GRID_CELL_SIZE = 2.0f * LARGE_ASTEROID_RADIUS * ASTEROID_SCALE;
 
 // Game rules
 inline constexpr int POINTS_LARGE_ASTEROID = 20;
@@ -1,57 +1,198 @@
 // include/DebugUtils.hpp
 #pragma once
-#include <iostream>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <iostream>
+#include <memory>
 #include <string>
-#include <chrono>
-#include <sstream>
+#include <string_view>
+#include <thread>
+#include <type_traits>
 
+// Compile-time log levels. Macros above ASTEROIDS_LOG_LEVEL expand to nothing,
+// so their arguments are never evaluated.
+#define ASTEROIDS_LOG_LEVEL_OFF 0
+#define ASTEROIDS_LOG_LEVEL_ERROR 1
+#define ASTEROIDS_LOG_LEVEL_WARN 2
+#define ASTEROIDS_LOG_LEVEL_INFO 3
+#define ASTEROIDS_LOG_LEVEL_DEBUG 4
+#define ASTEROIDS_LOG_LEVEL_TRACE 5
+
+#ifndef ASTEROIDS_LOG_LEVEL
+#define ASTEROIDS_LOG_LEVEL ASTEROIDS_LOG_LEVEL_WARN
+#endif
+
+// Asynchronous logger. Callers copy their message into a lock-free ring
+// buffer; a background thread drains it to game_debug.log in batches.
+// When the ring is full, messages are dropped and counted rather than blocking.
 class GameLogger {
 public:
+    enum class Level : uint8_t { Error = 1, Warn, Info, Debug, Trace };
+
     static GameLogger& instance() {
         static GameLogger logger;
         return logger;
     }
 
-    template<typename T>
-    void log(const T& message) {
-        if (!logFile.is_open()) return;
-        
-        auto now = std::chrono::system_clock::now();
-        auto now_c = std::chrono::system_clock::to_time_t(now);
-        
-        std::stringstream ss;
-        std::string timestamp = std::string(std::ctime(&now_c));
-
-        // remove trailing whitespace
-        timestamp.resize(timestamp.find_last_not_of(" \n\r\t") + 1);
-
-        ss << timestamp << ": " << message << std::endl;
-        
-        logFile << ss.str();
-        logFile.flush();
+    void log(Level level, std::string_view message) {
+        Slot* slot = claim();
+        if (!slot) return;
+        Record& record = slot->record;
+        record.level = level;
+        record.kind = ValueKind::None;
+        copyText(record, message);
+        publish(slot);
     }
 
-private:
-    GameLogger() {
-        logFile.open("game_debug.log", std::ios::out | std::ios::app);
+    // Logs "name: value" without formatting on the caller's thread
+    template<typename T, typename = std::enable_if_t<std::is_arithmetic_v<T>>>
+    void logValue(Level level, std::string_view name, T value) {
+        Slot* slot = claim();
+        if (!slot) return;
+        Record& record = slot->record;
+        record.level = level;
+        if constexpr (std::is_floating_point_v<T>) {
+            record.kind = ValueKind::Float;
+            record.floatValue = static_cast<double>(value);
+        } else if constexpr (std::is_signed_v<T>) {
+            record.kind = ValueKind::Signed;
+            record.intValue = static_cast<int64_t>(value);
+        } else {
+            record.kind = ValueKind::Unsigned;
+            record.uintValue = static_cast<uint64_t>(value);
+        }
+        copyText(record, name);
+        publish(slot);
     }
-    
-    ~GameLogger() {
-        if (logFile.is_open()) {
-            logFile.close();
+
+    // Block until everything logged so far has been written
+    void flush();
+
+    // Messages lost to a full ring since startup
+    uint64_t droppedCount() const { return dropped.load(std::memory_order_relaxed); }
+
+private:
+    static constexpr size_t CAPACITY = 4096;       // Power of two
+    static constexpr size_t MAX_TEXT = 118;
+
+    enum class ValueKind : uint8_t { None, Signed, Unsigned, Float };
+
+    struct Record {
+        uint64_t timestampNs;
+        union {
+            int64_t intValue;
+            uint64_t uintValue;
+            double floatValue;
+        };
+        Level level;
+        ValueKind kind;
+        uint8_t length;
+        char text[MAX_TEXT];
+    };
+
+    struct Slot {
+        std::atomic<size_t> sequence;
+        Record record;
+    };
+
+    GameLogger();
+    ~GameLogger();
+
+    // Bounded multi-producer queue (Vyukov): a slot is free for position p
+    // when its sequence equals p and readable when it equals p + 1.
+    Slot* claim() {
+        size_t position = enqueuePosition.load(std::memory_order_relaxed);
+        for (;;) {
+            Slot& slot = slots[position & (CAPACITY - 1)];
+            size_t sequence = slot.sequence.load(std::memory_order_acquire);
+            intptr_t diff = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+            if (diff == 0) {
+                if (enqueuePosition.compare_exchange_weak(position, position + 1,
+                                                          std::memory_order_relaxed)) {
+                    slot.record.timestampNs = static_cast<uint64_t>(
+                        std::chrono::duration_cast<std::chrono::nanoseconds>(
+                            std::chrono::steady_clock::now() - startTime).count());
+                    return &slot;
+                }
+            } else if (diff < 0) {
+                dropped.fetch_add(1, std::memory_order_relaxed);
+                return nullptr;
+            } else {
+                position = enqueuePosition.load(std::memory_order_relaxed);
+            }
         }
     }
 
+    static void publish(Slot* slot) {
+        size_t sequence = slot->sequence.load(std::memory_order_relaxed);
+        slot->sequence.store(sequence + 1, std::memory_order_release);
+    }
+
+    static void copyText(Record& record, std::string_view text) {
+        size_t length = std::min(text.size(), MAX_TEXT);
+        std::memcpy(record.text, text.data(), length);
+        record.length = static_cast<uint8_t>(length);
+    }
+
+    void drainLoop();
+    size_t drainBatch(std::string& batch);
+
     std::ofstream logFile;
+    std::unique_ptr<Slot[]> slots;
+    std::atomic<size_t> enqueuePosition{0};
+    size_t dequeuePosition{0};                    // Drain thread only
+    uint64_t reportedDrops{0};                    // Drain thread only
+    std::atomic<size_t> writtenPosition{0};
+    std::atomic<uint64_t> dropped{0};
+    std::atomic<bool> running{true};
+    std::chrono::steady_clock::time_point startTime;
+    std::thread drainThread;
 };
 
-#define LOG(msg) GameLogger::instance().log(msg)
-#define LOG_VALUE(name, value) GameLogger::instance().log(std::string(name) + ": " + std::to_string(value))
-#define LOG_VECTOR(name, vec) GameLogger::instance().log(std::string(name) + ": size = " + std::to_string(vec.size()))
+#if ASTEROIDS_LOG_LEVEL >= ASTEROIDS_LOG_LEVEL_ERROR
+#define LOG_ERROR(msg) GameLogger::instance().log(GameLogger::Level::Error, msg)
+#else
+#define LOG_ERROR(msg) ((void)0)
+#endif
+
+#if ASTEROIDS_LOG_LEVEL >= ASTEROIDS_LOG_LEVEL_WARN
+#define LOG_WARN(msg) GameLogger::instance().log(GameLogger::Level::Warn, msg)
+#else
+#define LOG_WARN(msg) ((void)0)
+#endif
+
+#if ASTEROIDS_LOG_LEVEL >= ASTEROIDS_LOG_LEVEL_INFO
+#define LOG(msg) GameLogger::instance().log(GameLogger::Level::Info, msg)
+#else
+#define LOG(msg) ((void)0)
+#endif
+
+#if ASTEROIDS_LOG_LEVEL >= ASTEROIDS_LOG_LEVEL_DEBUG
+#define LOG_VALUE(name, value) GameLogger::instance().logValue(GameLogger::Level::Debug, name, value)
+#define LOG_VECTOR(name, vec) GameLogger::instance().logValue(GameLogger::Level::Debug, name, (vec).size())
+#else
+#define LOG_VALUE(name, value) ((void)0)
+#define LOG_VECTOR(name, vec) ((void)0)
+#endif
+
+#define ASTEROIDS_STRINGIFY_(x) #x
+#define ASTEROIDS_STRINGIFY(x) ASTEROIDS_STRINGIFY_(x)
+
+#if ASTEROIDS_LOG_LEVEL >= ASTEROIDS_LOG_LEVEL_TRACE
+#define LOG_TRACE(msg) GameLogger::instance().log(GameLogger::Level::Trace, msg)
+#define GOT_HERE() GameLogger::instance().log(GameLogger::Level::Trace, \
+    __FILE__ ":" ASTEROIDS_STRINGIFY(__LINE__))
+#else
+#define LOG_TRACE(msg) ((void)0)
+#define GOT_HERE() ((void)0)
+#endif
+
 #define ASSERT_LOG(condition, msg) \
     if (!(condition)) { \
-        LOG("Assertion failed: " + std::string(msg)); \
+        LOG_ERROR("Assertion failed: " + std::string(msg)); \
         std::cerr << "Assertion failed: " << msg << std::endl; \
     }
-#define GOT_HERE() LOG(std::string(__FILE__) + ":" + std::to_string(__LINE__))
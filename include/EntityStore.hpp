@@ -0,0 +1,114 @@
+// include/EntityStore.hpp
+#pragma once
+#include <algorithm>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include "GameObject.hpp"
+#include "RenderCommandList.hpp"
+
+// Dense, by-value storage for one final entity type.
+//
+// GameObjectManager keeps pooled pointers so spawned objects never move;
+// this store trades that for contiguous objects walked in order, with
+// update() and draw() bound at compile time rather than through the vtable.
+// References and indices are invalidated by spawn() and compact(). Removal
+// is deferred and order-preserving, as in GameObjectManager, so iteration
+// order (and anything that breaks ties by index) stays deterministic.
+template<typename T>
+class EntityStore {
+    static_assert(std::is_base_of_v<GameObject, T>, "EntityStore holds game objects");
+    static_assert(std::is_final_v<T>, "Declare the entity final so its calls bind statically");
+
+public:
+    void reserve(size_t count) {
+        entities.reserve(count);
+        deadFlags.reserve(count);
+    }
+
+    template<typename... Args>
+    T& spawn(Args&&... args) {
+        entities.emplace_back(std::forward<Args>(args)...);
+        deadFlags.push_back(0);
+        return entities.back();
+    }
+
+    // Drops marked entities, then steps the rest
+    void update(float deltaTime) {
+        compact();
+        for (T& entity : entities) {
+            entity.T::update(deltaTime);
+        }
+    }
+
+    void draw(RenderCommandList& commands, float alpha) {
+        for (T& entity : entities) {
+            entity.T::draw(commands, alpha);
+        }
+    }
+
+    void markForRemoval(size_t index) {
+        if (!deadFlags[index]) {
+            deadFlags[index] = 1;
+            ++markedCount;
+        }
+    }
+
+    bool isMarkedForRemoval(size_t index) const {
+        return markedCount > 0 && deadFlags[index];
+    }
+
+    size_t markedForRemoval() const { return markedCount; }
+
+    // Destroy every marked entity in one stable pass
+    void compact() {
+        if (markedCount == 0) return;
+
+        size_t kept = 0;
+        for (size_t i = 0; i < entities.size(); ++i) {
+            if (deadFlags[i]) {
+                deadFlags[i] = 0;
+                continue;
+            }
+            if (kept != i) {
+                entities[kept] = std::move(entities[i]);
+            }
+            ++kept;
+        }
+        entities.erase(entities.begin() + kept, entities.end());
+        deadFlags.resize(kept);
+        markedCount = 0;
+    }
+
+    // Immediate, order-preserving removal. Applies any marks first.
+    template<typename Predicate>
+    void removeIf(Predicate predicate) {
+        compact();
+        entities.erase(std::remove_if(entities.begin(), entities.end(), predicate),
+                       entities.end());
+        deadFlags.resize(entities.size());
+    }
+
+    void clear() {
+        entities.clear();
+        deadFlags.clear();
+        markedCount = 0;
+    }
+
+    size_t size() const { return entities.size(); }
+    bool empty() const { return entities.empty(); }
+
+    T& operator[](size_t index) { return entities[index]; }
+    const T& operator[](size_t index) const { return entities[index]; }
+
+    auto begin() { return entities.begin(); }
+    auto end() { return entities.end(); }
+    auto begin() const { return entities.begin(); }
+    auto end() const { return entities.end(); }
+
+private:
+    std::vector<T> entities;
+    std::vector<uint8_t> deadFlags;  // Indexed like entities; all clear when markedCount is 0
+    size_t markedCount = 0;
+};
@@ -0,0 +1,123 @@
+// include/EnvBatch.hpp
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "GameState.hpp"
+#include "InputSource.hpp"
+#include "ThreadPool.hpp"
+#include "Vector2D.hpp"
+#include "WorldConfig.hpp"
+
+// Gym-style vectorised environment: B independent GameStates stepped
+// together from an action array, reporting a flat [B x observationSize()]
+// float tensor, one reward and one done flag per environment.
+//
+// An environment is done when its ship dies or its field is cleared. Like
+// Gym's vector environments it then resets at once, so its row holds the
+// first observation of the next episode while its reward and done flag
+// still describe the step that ended. Output buffers are allocated up front
+// and overwritten in place, and per-environment scratch is reserved for a
+// fully split field, so steps allocate nothing unless an episode restarts
+// (a new ship builds its bullet pool) or a huge field outgrows the reserve.
+//
+// Each row holds, normalised to roughly [-1, 1]:
+//   ship        x / width, y / height, velocity / max speed (2),
+//               heading unit vector (2)
+//   asteroids   nearest K, closest first, each as present (1 or 0), wrap-aware
+//               offset / sensor range (2), velocity relative to the ship /
+//               max speed (2), radius / large radius; absent slots are zero
+//   rays        distance to the first asteroid surface along each ray, /
+//               sensor range and capped at 1; rays fan out evenly from the
+//               heading, clockwise, and see across the wrap, so a range
+//               wider than the world meets the same asteroid more than once
+class EnvBatch {
+public:
+    // Bit flags, one byte per environment
+    enum Action : uint8_t {
+        ROTATE_LEFT = 1 << 0,
+        ROTATE_RIGHT = 1 << 1,
+        THRUST = 1 << 2,
+        FIRE = 1 << 3,
+    };
+
+    struct Options {
+        uint32_t seed = 0;            // Environment i is seeded like WorldBatch world i
+        std::shared_ptr<const WorldConfig> config;  // Classic world when null
+        int nearestAsteroids = 8;     // K
+        int rays = 16;
+        float sensorRange = 400.0f;   // Pixels; offsets and ray distances are scaled by it
+        int ticksPerStep = 1;         // Each action is held this many ticks, rewards summed
+    };
+
+    static constexpr size_t SHIP_FEATURES = 6;
+    static constexpr size_t ASTEROID_FEATURES = 6;
+
+    // Throws std::invalid_argument for an empty batch or bad options
+    EnvBatch(size_t envCount, const Options& options);
+
+    size_t size() const { return envs.size(); }
+    size_t observationSize() const { return observationStride; }
+
+    // Restart every environment and observe it. Rewards and dones are cleared.
+    void reset(ThreadPool* pool = nullptr);
+
+    // Apply actions[i] to environment i, step, and observe. Environments run
+    // in parallel on pool when given; results are the same either way.
+    // reset() and step() rethrow the first environment's exception,
+    // typically std::bad_alloc from an episode restart, after every pooled
+    // environment has finished; the batch should then be reset before
+    // further use.
+    void step(const uint8_t* actions, ThreadPool* pool = nullptr);
+
+    // Recompute every row from the worlds as they are now
+    void observe(ThreadPool* pool = nullptr);
+
+    // Valid until the next reset(), step() or observe()
+    const float* observations() const { return observationBuffer.data(); }
+    const float* rewards() const { return rewardBuffer.data(); }
+    const uint8_t* dones() const { return doneBuffer.data(); }
+
+    GameState& getWorld(size_t index) { return *envs[index].state; }
+    const GameState& getWorld(size_t index) const { return *envs[index].state; }
+
+private:
+    // Own cache line each, so environments on different threads never
+    // false-share their scratch bookkeeping
+    struct alignas(64) Env {
+        std::unique_ptr<GameState> state;
+        ActionInput* input = nullptr;   // Owned by state
+
+        // Asteroids relative to the ship, gathered into parallel arrays so
+        // the distance and ray passes run over contiguous floats
+        std::vector<float> offsetX;
+        std::vector<float> offsetY;
+        std::vector<float> velocityX;
+        std::vector<float> velocityY;
+        std::vector<float> radius;
+        std::vector<float> distanceSq;
+        std::vector<uint32_t> order;    // Indices being ranked by distance
+        std::vector<float> rayX;        // This observation's ray directions
+        std::vector<float> rayY;
+    };
+
+    template<typename Fn>
+    void forEachEnv(ThreadPool* pool, Fn&& fn);
+    void stepEnv(size_t index, uint8_t action);
+    void observeEnv(size_t index);
+    void gatherAsteroids(Env& env, const sf::Vector2f& shipPosition, const sf::Vector2f& shipVelocity);
+    void writeNearest(Env& env, float* out) const;
+    void writeRays(Env& env, const Vec2& heading, float* out) const;
+
+    Options options;
+    std::shared_ptr<const WorldConfig> config;
+    size_t observationStride;
+    std::vector<float> rayOffsetCos;    // Unit ray directions relative to the heading
+    std::vector<float> rayOffsetSin;
+
+    std::vector<Env> envs;
+    std::vector<float> observationBuffer;
+    std::vector<float> rewardBuffer;
+    std::vector<uint8_t> doneBuffer;
+};
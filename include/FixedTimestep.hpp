@@ -0,0 +1,56 @@
+// include/FixedTimestep.hpp
+#pragma once
+#include <algorithm>
+#include "Constants.hpp"
+
+// Accumulator for running the simulation at a fixed rate regardless of the
+// frame rate. Each frame, feed it the elapsed wall time and simulate the
+// returned number of steps, then render with getAlpha() to blend between the
+// previous and current simulation states.
+class FixedTimestep {
+public:
+    explicit FixedTimestep(float ticksPerSecond = SIMULATION_TICK_RATE,
+                           int maxCatchUpSteps = MAX_CATCH_UP_STEPS) {
+        setTickRate(ticksPerSecond);
+        setMaxCatchUpSteps(maxCatchUpSteps);
+    }
+
+    void setTickRate(float ticksPerSecond) {
+        step = 1.0f / std::max(ticksPerSecond, 1.0f);
+        accumulator = std::min(accumulator, step);
+    }
+
+    void setMaxCatchUpSteps(int steps) { maxSteps = std::max(steps, 1); }
+
+    // Returns how many fixed steps to simulate for this frame. After a long
+    // hitch the backlog is capped at maxSteps and the rest is thrown away,
+    // so a slow frame can never snowball into ever slower frames.
+    int advance(float frameSeconds) {
+        accumulator += std::max(frameSeconds, 0.0f);
+
+        int steps = static_cast<int>(accumulator / step);
+        if (steps > maxSteps) {
+            steps = maxSteps;
+            droppedTime += accumulator - steps * step;
+            accumulator = 0.0f;
+        } else {
+            accumulator -= steps * step;
+        }
+        return steps;
+    }
+
+    // Seconds simulated per step
+    float getStep() const { return step; }
+
+    // How far the renderer is between the last two simulation states, [0, 1)
+    float getAlpha() const { return std::min(accumulator / step, 1.0f); }
+
+    // Wall time discarded because the simulation could not keep up
+    float getDroppedTime() const { return droppedTime; }
+
+private:
+    float step = 1.0f / SIMULATION_TICK_RATE;
+    float accumulator = 0.0f;
+    float droppedTime = 0.0f;
+    int maxSteps = MAX_CATCH_UP_STEPS;
+};
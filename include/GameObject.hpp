@@ -1,8 +1,16 @@
 // include/GameObject.hpp
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <cmath>
+#include "RenderCommandList.hpp"
 #include "DebugUtils.hpp"
+#include "Constants.hpp"
+#include "WorldConfig.hpp"
 
+// Base for everything in the world. Concrete entities are declared final, so
+// containers templated on the entity type (GameObjectManager, EntityStore)
+// call update() and draw() without a vtable lookup and can inline them; the
+// virtuals only cost a dispatch when called through a GameObject pointer.
 class GameObject {
 public:
     // Virtual destructor for proper cleanup of derived classes
@@ -10,25 +18,69 @@ public:
     
     // Core functionality every game object must implement
     virtual void update(float deltaTime) = 0;
-    virtual void draw(sf::RenderWindow& window) = 0;
+
+    // alpha blends from the previous update's state (0) to the current one (1)
+    virtual void draw(RenderCommandList& commands, float alpha) = 0;
     
-    // Position management
-    void setPosition(const sf::Vector2f& pos) { position = pos; }
+    // Position management. Setting a position is a teleport: it is not
+    // interpolated from wherever the object was before.
+    void setPosition(const sf::Vector2f& pos) { position = pos; previousPosition = pos; }
     const sf::Vector2f& getPosition() const { return position; }
+    const sf::Vector2f& getPreviousPosition() const { return previousPosition; }
+
+    // Render position between the last two updates
+    sf::Vector2f getInterpolatedPosition(float alpha) const {
+        return interpolate(previousPosition, position, alpha, config->size());
+    }
+
+    static sf::Vector2f interpolate(const sf::Vector2f& from, const sf::Vector2f& to, float alpha,
+                                    const sf::Vector2f& world) {
+        sf::Vector2f delta = to - from;
+        // Wrapping jumps across the world; snap instead of sweeping back
+        if (std::abs(delta.x) > world.x / 2.0f || std::abs(delta.y) > world.y / 2.0f) {
+            return to;
+        }
+        return from + delta * alpha;
+    }
     
+    static float lerp(float from, float to, float alpha) { return from + (to - from) * alpha; }
+
     // Velocity management - common to most game objects
     void setVelocity(const sf::Vector2f& vel) { velocity = vel; }
     const sf::Vector2f& getVelocity() const { return velocity; }
 
+    // Motion state shared by every object, as stored in snapshots
+    struct Body {
+        sf::Vector2f position;
+        sf::Vector2f previousPosition;
+        sf::Vector2f velocity;
+    };
+
+    // World this object lives in; outlives the object
+    const WorldConfig& getConfig() const { return *config; }
+
+    Body getBody() const { return Body{position, previousPosition, velocity}; }
+    void setBody(const Body& body) {
+        position = body.position;
+        previousPosition = body.previousPosition;
+        velocity = body.velocity;
+    }
+
 protected:
     sf::Vector2f position;
+    sf::Vector2f previousPosition;
     sf::Vector2f velocity;
+    const WorldConfig* config = &WorldConfig::defaults();
+
+    // Call at the start of update() so draw() can interpolate
+    void savePreviousState() { previousPosition = position; }
+
     
-    // Utility function for wrapping objects around screen edges
-    void wrapPosition(float screenWidth, float screenHeight) {
-        if (position.x < 0) position.x = screenWidth;
-        if (position.x > screenWidth) position.x = 0;
-        if (position.y < 0) position.y = screenHeight;
-        if (position.y > screenHeight) position.y = 0;
+    // Utility function for wrapping objects around the world's edges
+    void wrapPosition() {
+        if (position.x < 0) position.x = config->width;
+        if (position.x > config->width) position.x = 0;
+        if (position.y < 0) position.y = config->height;
+        if (position.y > config->height) position.y = 0;
     }
 };
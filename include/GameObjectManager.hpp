@@ -2,15 +2,25 @@
 #include <vector>
 #include <memory>
 #include <algorithm>
-#include <functional>
+#include <cstdint>
 #include <SFML/Graphics.hpp>
+#include "RenderCommandList.hpp"
 #include "DebugUtils.hpp"
+#include "ObjectPool.hpp"
+#include "Profiler.hpp"
 
 template<typename T>
 class GameObjectManager {
 public:
+    using Pointer = PoolPtr<T>;
+    using Container = std::vector<Pointer>;
+
     void update(float deltaTime) {
+        PROFILE_SCOPE("GameObjectManager::update");
         GOT_HERE();
+        // Marks are indices into current, which is about to change
+        compact();
+
         // Move pending objects to current
         for (auto& obj : pending) {
             if (obj) {
@@ -32,20 +42,45 @@ public:
         current.swap(next);
         next.clear();
 
+        // Flags grow alongside the buffers so marking never allocates
+        if (deadFlags.size() < current.capacity()) {
+            deadFlags.resize(current.capacity(), 0);
+        }
+
         GOT_HERE();
     }
     
-    void draw(sf::RenderWindow& window) const {
+    void draw(RenderCommandList& commands, float alpha) const {
         for (const auto& obj : current) {
             if (obj) {
-                obj->draw(window);
+                obj->draw(commands, alpha);
             }
         }
     }
     
+    // Construct a new object in the manager's pool. It joins the update
+    // list on the next update(); the returned pointer stays valid until the
+    // object is removed.
+    template<typename... Args>
+    T* spawn(Args&&... args) {
+        T* obj = pool->create(std::forward<Args>(args)...);
+        pending.push_back(Pointer(obj, PoolDeleter<T>{pool.get()}));
+        return obj;
+    }
+
+    // Like spawn(), but the object joins the update list immediately.
+    // Used to rebuild a manager from a snapshot.
+    template<typename... Args>
+    T* spawnActive(Args&&... args) {
+        T* obj = pool->create(std::forward<Args>(args)...);
+        current.push_back(Pointer(obj, PoolDeleter<T>{pool.get()}));
+        return obj;
+    }
+
+    // Adopt an object allocated elsewhere
     void spawn(std::unique_ptr<T> obj) {
         if (obj) {
-            pending.push_back(std::move(obj));
+            pending.push_back(Pointer(obj.release(), PoolDeleter<T>{}));
         }
     }
     
@@ -53,6 +88,10 @@ public:
         current.clear();
         next.clear();
         pending.clear();
+        if (markedCount > 0) {
+            std::fill(deadFlags.begin(), deadFlags.end(), 0);
+            markedCount = 0;
+        }
     }
     
     size_t count() const {
@@ -63,37 +102,87 @@ public:
         return current.empty() && pending.empty();
     }
 
-    void removeIf(std::function<bool(const T&)> predicate) {
-        auto removeFromBuffer = [&predicate](std::vector<std::unique_ptr<T>>& buffer) {
+    // Deferred removal: mark objects by their index in getObjects() while
+    // iterating, then drop them all with one compact(). Marking never moves
+    // anything, so indices, references and iterators stay valid until then.
+    // Only objects that have been through update() can be marked.
+    void markForRemoval(size_t index) {
+        if (!deadFlags[index]) {
+            deadFlags[index] = 1;
+            ++markedCount;
+        }
+    }
+
+    bool isMarkedForRemoval(size_t index) const {
+        return markedCount > 0 && deadFlags[index];
+    }
+
+    // Destroy every marked object in one stable pass over current
+    void compact() {
+        if (markedCount == 0) return;
+
+        size_t kept = 0;
+        for (size_t i = 0; i < current.size(); ++i) {
+            if (deadFlags[i]) {
+                deadFlags[i] = 0;
+            } else {
+                if (kept != i) {
+                    current[kept] = std::move(current[i]);
+                }
+                ++kept;
+            }
+        }
+        current.resize(kept);
+
+        LOG_VALUE("Compacted", markedCount);
+        markedCount = 0;
+    }
+
+    size_t markedForRemoval() const { return markedCount; }
+
+    // Immediate removal from both current and pending. Applies any marks first.
+    template<typename Predicate>
+    void removeIf(Predicate predicate) {
+        compact();
+
+        auto removeFromBuffer = [&predicate](Container& buffer) {
             auto it = std::remove_if(buffer.begin(), buffer.end(),
-                [&predicate](const std::unique_ptr<T>& obj) {
+                [&predicate](const Pointer& obj) {
                     return obj && predicate(*obj);
                 });
             buffer.erase(it, buffer.end());
         };
 
-        size_t currentSizeBefore = current.size();
-        size_t pendingSizeBefore = pending.size();
+        LOG_VALUE("Current size before", current.size());
+        LOG_VALUE("Pending size before", pending.size());
         removeFromBuffer(current);
         removeFromBuffer(pending);
-        size_t currentSizeAfter = current.size();
-        size_t pendingSizeAfter = pending.size();
-        LOG_VALUE("Current size before", currentSizeBefore);
-        LOG_VALUE("Current size after", currentSizeAfter);
-        LOG_VALUE("Pending size before", pendingSizeBefore);
-        LOG_VALUE("Pending size after", pendingSizeAfter);
+        LOG_VALUE("Current size after", current.size());
+        LOG_VALUE("Pending size after", pending.size());
     }
     
-    const std::vector<std::unique_ptr<T>>& getObjects() const {
-        LOG("Getting objects");
+    const Container& getObjects() const {
+        LOG_TRACE("Getting objects");
         LOG_VALUE("Current size", current.size());
         LOG_VALUE("Pending size", pending.size());
         LOG_VALUE("Next size", next.size());
         return current;
     }
 
+    // Objects spawned since the last update()
+    const Container& getPending() const { return pending; }
+
+    // Slots allocated for pooled objects, live or recycled
+    size_t poolCapacity() const { return pool->capacity(); }
+
 private:
-    std::vector<std::unique_ptr<T>> current;
-    std::vector<std::unique_ptr<T>> next;
-    std::vector<std::unique_ptr<T>> pending;
+    // Declared first so it outlives the objects it owns. Held by pointer so
+    // the deleters' pool address survives moving the manager.
+    std::unique_ptr<ObjectPool<T>> pool = std::make_unique<ObjectPool<T>>();
+    Container current;
+    Container next;
+    Container pending;
+
+    std::vector<uint8_t> deadFlags;  // Indexed like current; all clear when markedCount is 0
+    size_t markedCount = 0;
 };
@@ -1,45 +1,165 @@
 // include/GameState.hpp
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cstdint>
 #include <memory>
 #include <optional>
 #include <vector>
 #include "Ship.hpp"
 #include "Asteroid.hpp"
 #include "GameObjectManager.hpp"
+#include "BatchRenderer.hpp"
+#include "RenderSnapshot.hpp"
 #include "CollisionManager.hpp"
+#include "SpatialHash.hpp"
 #include "Constants.hpp"
+#include "InputSource.hpp"
+#include "Random.hpp"
+#include "ThreadPool.hpp"
+#include "WorldConfig.hpp"
 
 class GameState {
 public:
+    // Without an input source the ship sits idle (useful headless)
     GameState();
+    explicit GameState(std::unique_ptr<InputSource> input);
+    // All randomness comes from a generator seeded here, so equal seeds and
+    // inputs replay identically and separate instances share no state
+    GameState(std::unique_ptr<InputSource> input, uint32_t seed);
+    // As above in a world sized and tuned by config, which is validated and
+    // shared with every object in the world
+    GameState(std::unique_ptr<InputSource> input, uint32_t seed,
+              std::shared_ptr<const WorldConfig> config);
     
     void update(float deltaTime);
-    void draw(sf::RenderWindow& window);
+    // alpha interpolates between the last two updates, see FixedTimestep
+    void draw(sf::RenderTarget& target, float alpha = 1.0f);
+    // Append the frame to a command list instead; needs no window or font
+    void draw(RenderCommandList& out, float alpha = 1.0f);
+
+    // Copy what draw() needs into out, reusing its capacity. Lets another
+    // thread draw this state while the simulation moves on.
+    void captureRenderSnapshot(RenderSnapshot& out) const;
     void reset();
     
     bool isGameOver() const { return !ship.has_value(); }
     bool isGameWon() const { return !isGameOver() && asteroidManager.count() == 0; }
     int getScore() const { return score; }
+    uint32_t getSeed() const { return seed; }
+    const WorldConfig& getConfig() const { return *config; }
     size_t getAsteroidCount() const { return asteroidManager.count(); }
+
+    // Draw calls issued by the last draw()
+    int getDrawCalls() const { return renderer.getDrawCalls(); }
+
+    // HUD texts rebuilt by the last draw(), 0 when score and phase held still
+    int getHudRebuilds() const { return renderer.getHudRebuilds(); }
+
+    // Loaded on first use and shared with the caller; nullptr if unavailable
+    const sf::Font* getFont();
     
-    const std::vector<std::unique_ptr<Asteroid>>& getAsteroids() const { 
+    const GameObjectManager<Asteroid>::Container& getAsteroids() const { 
         return asteroidManager.getObjects(); 
     }
 
+    // Spawned since the last update(), such as a fresh field or new splits
+    const GameObjectManager<Asteroid>::Container& getPendingAsteroids() const {
+        return asteroidManager.getPending();
+    }
+
     const Ship* getShip() const { return ship ? &*ship : nullptr; }
     Ship* getShip() { return ship ? &*ship : nullptr; }
 
+    void setInputSource(std::unique_ptr<InputSource> source) { input = std::move(source); }
+
+    // Spread the collision phase over pool's threads, or run it on the
+    // calling thread when null. Results are bit-identical either way. Grid
+    // staging splits once a world holds more than ASTEROIDS_PER_CHUNK
+    // asteroids and the bullet pass once more than BULLETS_PER_CHUNK
+    // bullets fly; the grid's counting sort, the ship test and resolving
+    // hits stay serial. update() must not itself run as a task of the pool.
+    void setThreadPool(ThreadPool* pool) { collisionPool = pool; }
+
+    // Most ticks the caller may run between snapshots, the FixedTimestep
+    // catch-up limit; explosions are kept for twice that so none is missed
+    void setMaxCatchUpSteps(int steps) {
+        explosionHistoryTicks = 2 * static_cast<uint64_t>(std::max(steps, 1));
+    }
+
+    // Flat, versioned copy of the simulation: ship, bullets, asteroids with
+    // their shapes, score and RNG. The input source and render state are not
+    // included. Reuses out's capacity, so snapshotting every tick stops
+    // allocating once the buffer has grown.
+    void saveSnapshot(std::vector<uint8_t>& out) const;
+
+    // Rebuilds objects in the managers' pools rather than on the heap.
+    // Throws std::runtime_error if data is not a snapshot of this version.
+    void restoreSnapshot(const std::vector<uint8_t>& data);
+
 private:
+    // Benchmarks drive the collision and split paths directly
+    friend class GameStateBenchmark;
+
+    std::shared_ptr<const WorldConfig> config;  // Declared first: objects below point into it
+    uint32_t seed;
+    Random rng;
     std::optional<Ship> ship;
     GameObjectManager<Asteroid> asteroidManager;
+    std::unique_ptr<InputSource> input;
     sf::Font font;
+    bool fontLoadAttempted{false};
+    bool fontLoaded{false};
+    RenderSnapshot frame;       // Refilled by every draw()
+    SnapshotRenderer renderer;
     int score{0};
+    uint64_t tick{0};           // Updates so far, including idle ones after game over
+
+    // Destructions of recent ticks, oldest first, passed on to snapshots for
+    // the renderer's debris. Kept long enough to span any gap between draws.
+    std::vector<RenderSnapshot::Explosion> explosions;
+    uint64_t explosionHistoryTicks{2 * MAX_CATCH_UP_STEPS};
+
+    // Broadphase grid over the configured world, rebuilt in place every tick
+    SpatialHash asteroidGrid{config->width, config->height, ASTEROID_GRID_CELL_SIZE};
+    // Farthest any asteroid moved this tick; grid queries reach this much further
+    float asteroidStepReach{0.0f};
+
+    // Per-chunk maxima from staging the grid, reduced once all chunks finish
+    struct alignas(64) GridChunk {
+        float maxRadius;
+        float longestStepSquared;
+    };
+    static constexpr size_t ASTEROIDS_PER_CHUNK = 4096;
+    std::vector<GridChunk> gridChunks;
+
+    // Bullet-versus-asteroid contacts, gathered per chunk of bullets so no
+    // two workers share a buffer, then resolved serially in bullet order.
+    // Within a bullet, candidates are sorted by time of impact, then id.
+    struct BulletHit {
+        uint32_t bullet;
+        uint32_t asteroid;
+        float timeOfImpact;
+    };
+    struct alignas(64) HitChunk {
+        std::vector<BulletHit> hits;   // Cleared, not freed, every tick
+    };
+    static constexpr size_t BULLETS_PER_CHUNK = 32;
+    std::vector<HitChunk> hitChunks;
+    ThreadPool* collisionPool{nullptr};
     
     void createInitialAsteroids();
     void checkCollisions();
+    void buildAsteroidGrid();
+    void stageAsteroids(size_t chunk);
+    void gatherBulletHits(size_t chunk);
+    void resolveBulletHits(size_t chunkCount);
+    template<typename Fn>
+    void querySweep(const GameObject& object, float radius, Fn&& fn) const;
     void spawnSmallerAsteroids(const Asteroid& original);
-    void handleGameOver();
-    void handleWin();
+    void loadFont();
+    void addExplosion(const GameObject& object, float radius);
+    void handleGameOver(const InputState& controls);
+    void handleWin(const InputState& controls);
     int getAsteroidPoints(Asteroid::Size size) const;
 };
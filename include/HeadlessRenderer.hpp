@@ -0,0 +1,64 @@
+// include/HeadlessRenderer.hpp
+#pragma once
+#include <cstdint>
+#include "RenderCommandList.hpp"
+
+// Backend that draws nothing: it counts what a frame would put on screen and
+// fingerprints it, so frames can be checked and timed without a window.
+class HeadlessRenderer {
+public:
+    struct Counts {
+        uint64_t lineSegments = 0;
+        uint64_t triangles = 0;     // Filled triangles, not counting circles
+        uint64_t circles = 0;
+        uint64_t lines = 0;         // Separate coloured segments, such as particles
+        uint64_t textRuns = 0;
+        uint64_t characters = 0;
+
+        Counts& operator+=(const Counts& other) {
+            lineSegments += other.lineSegments;
+            triangles += other.triangles;
+            circles += other.circles;
+            lines += other.lines;
+            textRuns += other.textRuns;
+            characters += other.characters;
+            return *this;
+        }
+    };
+
+    void submit(const RenderCommandList& commands) {
+        frame = Counts{};
+        for (const RenderCommandList::Command& command : commands.commands()) {
+            switch (command.kind) {
+                case RenderCommandList::Kind::LineLoop: frame.lineSegments += command.count; break;
+                case RenderCommandList::Kind::Triangles: frame.triangles += command.count / 3; break;
+                case RenderCommandList::Kind::Circle: ++frame.circles; break;
+                case RenderCommandList::Kind::Text:
+                    ++frame.textRuns;
+                    frame.characters += command.count;
+                    break;
+                case RenderCommandList::Kind::Lines: frame.lines += command.count / 2; break;
+            }
+        }
+        frameHash = commands.hash();
+        total += frame;
+        // Order-sensitive, so swapping two frames changes the result
+        sessionHash = (sessionHash ^ frameHash) * 0x100000001b3ull;
+        ++frames;
+    }
+
+    const Counts& lastFrame() const { return frame; }
+    uint64_t lastFrameHash() const { return frameHash; }
+
+    const Counts& totals() const { return total; }
+    uint64_t frameCount() const { return frames; }
+    // Fingerprint of every frame submitted so far, in order
+    uint64_t sessionDigest() const { return sessionHash; }
+
+private:
+    Counts frame;
+    Counts total;
+    uint64_t frameHash = 0;
+    uint64_t sessionHash = 0xcbf29ce484222325ull;
+    uint64_t frames = 0;
+};
@@ -0,0 +1,37 @@
+// include/Hud.hpp
+#pragma once
+#include <SFML/Graphics.hpp>
+#include "RenderCommandList.hpp"
+
+// Score and end-of-round banner. Strings are only reformatted when the score
+// or the game phase changes; the backend likewise only lays text out again
+// when a run's string changes, so steady frames just redraw cached glyphs.
+class Hud {
+public:
+    enum class Phase { Playing, GameOver, Won };
+
+    // Reformats whatever changed since the last call
+    void update(int score, Phase phase);
+
+    // Emit the text runs in screen coordinates
+    void draw(RenderCommandList& commands) const;
+
+    // Texts rebuilt by the last update(), 0 on a steady frame
+    int getFrameRebuilds() const { return frameRebuilds; }
+    // Texts rebuilt since construction
+    long getTotalRebuilds() const { return totalRebuilds; }
+
+private:
+    void rebuildScore(int score);
+    void rebuildBanner(Phase phase);
+
+    char scoreText[32] = {};
+    const char* bannerText = "";
+
+    bool dirty = true;          // Nothing built yet
+    int shownScore = 0;
+    Phase shownPhase = Phase::Playing;
+
+    int frameRebuilds = 0;
+    long totalRebuilds = 0;
+};
@@ -0,0 +1,179 @@
+// include/InputRecording.hpp
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+#include "InputSource.hpp"
+
+struct WorldConfig;
+
+// Binary session recordings: the world seed, the fixed step, a hash of the
+// world config and one input state per tick, stored as run-length encoded
+// 5-bit button masks.
+//
+// Layout (native endianness):
+//   Header
+//   uint32_t runs[runCount]       bits 0-4 buttons, bits 5-31 run length - 1
+//   padding to 8 bytes
+//   Keyframe keyframes[keyframeCount]
+//
+// Keyframe k locates tick k * keyframeInterval, so looking up the input for
+// any tick walks at most keyframeInterval ticks' worth of runs. Keyframes
+// index inputs only, not world state: a replay always starts from tick 0.
+namespace recording {
+
+constexpr char MAGIC[4] = {'A', 'S', 'T', 'R'};
+constexpr uint32_t VERSION = 2;
+constexpr uint32_t KEYFRAME_INTERVAL = 1024;   // Ticks
+constexpr uint32_t BUTTON_BITS = 5;
+constexpr uint32_t MAX_RUN_LENGTH = (1u << (32 - BUTTON_BITS));
+
+struct Header {
+    char magic[4];
+    uint32_t version;
+    uint32_t seed;
+    float stepSeconds;
+    uint64_t tickCount;
+    uint64_t runCount;
+    uint64_t keyframeCount;
+    uint32_t keyframeInterval;
+    uint32_t configHash;     // WorldConfig::hash() of the recorded world
+};
+
+struct Keyframe {
+    uint64_t runIndex;       // Run containing the keyframe's tick
+    uint64_t runStartTick;   // First tick of that run
+};
+
+inline uint8_t packInput(const InputState& state) {
+    return static_cast<uint8_t>(state.rotateLeft | (state.rotateRight << 1) |
+                                (state.thrust << 2) | (state.fire << 3) |
+                                (state.restart << 4));
+}
+
+inline InputState unpackInput(uint32_t bits) {
+    InputState state;
+    state.rotateLeft = bits & 1;
+    state.rotateRight = bits & 2;
+    state.thrust = bits & 4;
+    state.fire = bits & 8;
+    state.restart = bits & 16;
+    return state;
+}
+
+} // namespace recording
+
+// Streams a recording to disk as it is made. The header and keyframe index
+// are written by finish(), which the destructor calls if needed.
+// Throws std::runtime_error if the file cannot be written.
+class InputRecorder {
+public:
+    InputRecorder(const std::string& path, uint32_t seed, float stepSeconds,
+                  const WorldConfig& world);
+    ~InputRecorder();
+
+    InputRecorder(const InputRecorder&) = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+
+    void record(const InputState& state);
+    void finish();
+
+    uint64_t getTickCount() const { return tickCount; }
+
+private:
+    void closeRun();
+
+    std::ofstream file;
+    uint32_t seed;
+    float stepSeconds;
+    uint32_t configHash;
+    uint64_t tickCount = 0;
+    uint64_t runCount = 0;
+    uint32_t runBits = 0;
+    uint32_t runLength = 0;          // 0 = no open run
+    uint64_t runStartTick = 0;
+    std::vector<recording::Keyframe> keyframes;
+    bool finished = false;
+};
+
+// Read-only view of a recording file. Memory-mapped where the platform
+// allows, so opening a multi-hour session costs no copying.
+// Throws std::runtime_error on a missing or malformed file.
+class InputRecording {
+public:
+    explicit InputRecording(const std::string& path);
+    ~InputRecording();
+
+    InputRecording(const InputRecording&) = delete;
+    InputRecording& operator=(const InputRecording&) = delete;
+
+    uint32_t getSeed() const { return header.seed; }
+    float getStepSeconds() const { return header.stepSeconds; }
+    uint64_t getTickCount() const { return header.tickCount; }
+    uint64_t getRunCount() const { return header.runCount; }
+    uint32_t getConfigHash() const { return header.configHash; }
+
+    // The world must match the recorded one or the replay silently desyncs
+    bool recordedWith(const WorldConfig& world) const;
+
+    uint32_t runBits(uint64_t index) const { return runs[index] & ((1u << recording::BUTTON_BITS) - 1); }
+    uint64_t runLength(uint64_t index) const { return (runs[index] >> recording::BUTTON_BITS) + 1ull; }
+
+    // Run containing tick and the tick that run starts on
+    recording::Keyframe locate(uint64_t tick) const;
+
+    InputState inputAt(uint64_t tick) const;
+
+private:
+    void load(const std::string& path);
+    void validate(const std::string& path);
+    void unmap();
+
+    recording::Header header{};
+    const uint8_t* data = nullptr;
+    size_t size = 0;
+    const uint32_t* runs = nullptr;
+    const recording::Keyframe* keyframes = nullptr;
+    bool mapped = false;
+    std::vector<uint8_t> fallback;     // Used when mapping is unavailable
+};
+
+// Feeds a recording back through GameState::update, one tick per poll
+class ReplayInput : public InputSource {
+public:
+    explicit ReplayInput(std::shared_ptr<const InputRecording> recording)
+        : recording(std::move(recording)) {}
+
+    InputState poll() override;
+
+    uint64_t getTick() const { return tick; }
+    bool finished() const { return tick >= recording->getTickCount(); }
+
+private:
+    std::shared_ptr<const InputRecording> recording;
+    uint64_t tick = 0;
+    uint64_t runIndex = 0;
+    uint64_t runStartTick = 0;
+};
+
+// Passes another source through unchanged while recording what it returned
+class RecordingInput : public InputSource {
+public:
+    RecordingInput(std::unique_ptr<InputSource> inner, std::unique_ptr<InputRecorder> recorder)
+        : inner(std::move(inner)), recorder(std::move(recorder)) {}
+
+    InputState poll() override {
+        InputState state = inner->poll();
+        recorder->record(state);
+        return state;
+    }
+
+    InputRecorder& getRecorder() { return *recorder; }
+
+private:
+    std::unique_ptr<InputSource> inner;
+    std::unique_ptr<InputRecorder> recorder;
+};
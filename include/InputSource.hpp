@@ -0,0 +1,78 @@
+// include/InputSource.hpp
+#pragma once
+#include <SFML/Window.hpp>
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+// Player controls sampled once per simulation tick
+struct InputState {
+    bool rotateLeft = false;
+    bool rotateRight = false;
+    bool thrust = false;
+    bool fire = false;
+    bool restart = false;
+};
+
+// Where the simulation gets its controls from
+class InputSource {
+public:
+    virtual ~InputSource() = default;
+
+    // Called exactly once per GameState::update
+    virtual InputState poll() = 0;
+};
+
+// Live keyboard: J/L rotate, K thrust, Space fire, R restart
+class KeyboardInput : public InputSource {
+public:
+    InputState poll() override {
+        InputState state;
+        state.rotateLeft = sf::Keyboard::isKeyPressed(sf::Keyboard::J);
+        state.rotateRight = sf::Keyboard::isKeyPressed(sf::Keyboard::L);
+        state.thrust = sf::Keyboard::isKeyPressed(sf::Keyboard::K);
+        state.fire = sf::Keyboard::isKeyPressed(sf::Keyboard::Space);
+        state.restart = sf::Keyboard::isKeyPressed(sf::Keyboard::R);
+        return state;
+    }
+};
+
+// No buttons pressed, ever
+class NullInput : public InputSource {
+public:
+    InputState poll() override { return InputState{}; }
+};
+
+// Controls set from code, such as a training agent's actions, held until
+// set again
+class ActionInput : public InputSource {
+public:
+    void set(const InputState& controls) { held = controls; }
+    InputState poll() override { return held; }
+
+private:
+    InputState held;
+};
+
+// Plays back a fixed list of per-tick inputs, optionally looping
+class ScriptedInput : public InputSource {
+public:
+    explicit ScriptedInput(std::vector<InputState> ticks, bool loop = true)
+        : ticks(std::move(ticks)), loop(loop) {}
+
+    InputState poll() override {
+        if (ticks.empty()) return InputState{};
+        if (next >= ticks.size()) {
+            if (!loop) return InputState{};
+            next = 0;
+        }
+        return ticks[next++];
+    }
+
+    bool finished() const { return !loop && next >= ticks.size(); }
+
+private:
+    std::vector<InputState> ticks;
+    size_t next = 0;
+    bool loop;
+};
@@ -0,0 +1,90 @@
+// include/ObjectPool.hpp
+#pragma once
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+// Fixed-size slot allocator for one object type. Slots come from blocks that
+// are never returned to the heap while the pool lives, so once a pool has
+// grown to its working size, creating and destroying objects does not touch
+// the global allocator.
+template<typename T>
+class ObjectPool {
+public:
+    explicit ObjectPool(size_t slotsPerBlock = 64) : slotsPerBlock(slotsPerBlock) {}
+
+    ObjectPool(const ObjectPool&) = delete;
+    ObjectPool& operator=(const ObjectPool&) = delete;
+
+    template<typename... Args>
+    T* create(Args&&... args) {
+        if (!freeList) {
+            grow();
+        }
+        Slot* slot = freeList;
+        freeList = slot->next;
+
+        T* obj;
+        try {
+            obj = new (slot->storage) T(std::forward<Args>(args)...);
+        } catch (...) {
+            slot->next = freeList;
+            freeList = slot;
+            throw;
+        }
+        ++live;
+        return obj;
+    }
+
+    void destroy(T* obj) {
+        if (!obj) return;
+        obj->~T();
+        Slot* slot = reinterpret_cast<Slot*>(obj);
+        slot->next = freeList;
+        freeList = slot;
+        --live;
+    }
+
+    size_t capacity() const { return blocks.size() * slotsPerBlock; }
+    size_t size() const { return live; }
+
+private:
+    union Slot {
+        Slot* next;
+        alignas(T) unsigned char storage[sizeof(T)];
+    };
+
+    void grow() {
+        blocks.emplace_back(new Slot[slotsPerBlock]);
+        Slot* block = blocks.back().get();
+        for (size_t i = 0; i < slotsPerBlock; ++i) {
+            block[i].next = (i + 1 < slotsPerBlock) ? &block[i + 1] : freeList;
+        }
+        freeList = block;
+    }
+
+    size_t slotsPerBlock;
+    size_t live = 0;
+    Slot* freeList = nullptr;
+    std::vector<std::unique_ptr<Slot[]>> blocks;
+};
+
+// Returns pooled objects to their pool. Objects adopted from the heap carry
+// no pool and are deleted normally.
+template<typename T>
+struct PoolDeleter {
+    ObjectPool<T>* pool = nullptr;
+
+    void operator()(T* obj) const {
+        if (pool) {
+            pool->destroy(obj);
+        } else {
+            delete obj;
+        }
+    }
+};
+
+template<typename T>
+using PoolPtr = std::unique_ptr<T, PoolDeleter<T>>;
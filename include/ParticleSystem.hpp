@@ -0,0 +1,73 @@
+// include/ParticleSystem.hpp
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+#include "RenderCommandList.hpp"
+
+// Short-lived points for visual effects such as debris and exhaust.
+//
+// Structure-of-arrays storage in a fixed-capacity ring: particles are
+// appended at the head and retired from the tail, and emitting into a full
+// ring overwrites the oldest particle. Nothing allocates after construction
+// however many are emitted. Particles neither collide nor wrap; they fade
+// out over their lifetime and are drawn as one batch of streaks.
+class ParticleSystem {
+public:
+    // Capacity is rounded up to a power of two; 0 leaves the system unable
+    // to hold anything until setCapacity()
+    explicit ParticleSystem(size_t capacity = 0) { setCapacity(capacity); }
+
+    // Drops every particle. The only call that allocates.
+    void setCapacity(size_t capacity);
+
+    // Fraction of velocity lost per second, applied smoothly
+    void setDrag(float perSecond) { drag = perSecond; }
+
+    void emit(const sf::Vector2f& position, const sf::Vector2f& velocity, float lifetime,
+              const sf::Color& color);
+
+    // Integrate and age every particle, then retire expired ones from the tail
+    void update(float deltaTime);
+
+    // Append every live particle as a streak behind it, fading with age, in
+    // one Lines command
+    void draw(RenderCommandList& commands) const;
+
+    void clear() { head = tail = 0; }
+
+    // Particles between the oldest live one and the newest. One that expires
+    // before an older particle stays counted, drawn fully transparent, until
+    // the older one retires too.
+    size_t size() const { return static_cast<size_t>(head - tail); }
+    bool empty() const { return head == tail; }
+    size_t capacity() const { return positionX.size(); }
+
+    // By age, 0 being the oldest
+    sf::Vector2f getPosition(size_t i) const { return sf::Vector2f(positionX[slot(i)], positionY[slot(i)]); }
+    sf::Vector2f getVelocity(size_t i) const { return sf::Vector2f(velocityX[slot(i)], velocityY[slot(i)]); }
+    float getRemainingLife(size_t i) const { return life[slot(i)]; }
+
+    static constexpr float STREAK_SECONDS = 1.0f / 30.0f;  // Streak length, as time at current velocity
+
+private:
+    size_t slot(size_t i) const { return static_cast<size_t>(tail + i) & mask; }
+    void integrate(size_t first, size_t last, float deltaTime, float damping);
+    void writeStreaks(size_t first, size_t last, sf::Vertex* out) const;
+
+    // Hot state, touched by every update
+    std::vector<float> positionX;
+    std::vector<float> positionY;
+    std::vector<float> velocityX;
+    std::vector<float> velocityY;
+    std::vector<float> life;              // Seconds left; expired at 0 or below
+    // Read only when drawing
+    std::vector<float> inverseLifetime;
+    std::vector<sf::Color> color;
+
+    size_t mask = 0;
+    uint64_t head = 0;  // Emitted so far; slot of the next particle is head & mask
+    uint64_t tail = 0;  // Oldest live particle
+    float drag = 0.0f;
+};
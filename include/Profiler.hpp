@@ -0,0 +1,182 @@
+// include/Profiler.hpp
+#pragma once
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Frame profiler. PROFILE_SCOPE("name") times the enclosing block into a
+// per-phase latency histogram and, while a capture is running, into a
+// trace that can be exported for chrome://tracing / Perfetto or as CSV.
+//
+// Scopes are compiled in only when ASTEROIDS_PROFILE is 1 (CMake option
+// ASTEROIDS_PROFILE); otherwise PROFILE_SCOPE expands to nothing. Only
+// threads that called attachThisThread() record, each under its own trace
+// thread id. Registration and recording are locked, so the render thread,
+// the simulation thread and pool workers can all be attached at once.
+#ifndef ASTEROIDS_PROFILE
+#define ASTEROIDS_PROFILE 0
+#endif
+
+// Log-linear histogram of durations in nanoseconds: 8 buckets per power of
+// two, so any reported percentile is within 12.5% of the true value.
+class LatencyHistogram {
+public:
+    void add(uint64_t nanoseconds);
+    void clear();
+
+    uint64_t count() const { return total; }
+    uint64_t max() const { return largest; }
+    double mean() const { return total ? static_cast<double>(sum) / total : 0.0; }
+
+    // Upper edge of the bucket holding the given fraction of samples
+    uint64_t percentile(double fraction) const;
+
+private:
+    static constexpr int SUB_BITS = 3;
+    static constexpr int SUB_BUCKETS = 1 << SUB_BITS;
+    static constexpr int BUCKETS = (64 - SUB_BITS + 1) * SUB_BUCKETS;
+
+    static int bucketFor(uint64_t value);
+    static uint64_t bucketUpperEdge(int bucket);
+
+    std::array<uint32_t, BUCKETS> counts{};
+    uint64_t total = 0;
+    uint64_t sum = 0;
+    uint64_t largest = 0;
+};
+
+class Profiler {
+public:
+    static constexpr bool COMPILED_IN = ASTEROIDS_PROFILE != 0;
+    static constexpr size_t MAX_PHASES = 32;
+    static constexpr size_t MAX_TRACE_EVENTS = 1 << 20;
+
+    struct PhaseStats {
+        const char* name;
+        uint64_t count;
+        double meanUs;
+        double p50Us;
+        double p99Us;
+        double maxUs;
+    };
+
+    static Profiler& instance() {
+        static Profiler profiler;
+        return profiler;
+    }
+
+    // Scopes on the calling thread record from now on. Repeat calls are
+    // harmless; the first gives the thread its trace id.
+    static void attachThisThread() {
+        if (threadAttached) return;
+        threadAttached = true;
+        threadId = nextThreadId.fetch_add(1, std::memory_order_relaxed);
+    }
+    static bool isThreadAttached() { return threadAttached; }
+
+    // Phase id for a name, registering it on first use. Thread-safe. Names
+    // must be string literals or otherwise outlive the profiler.
+    int registerPhase(const char* name);
+
+    uint64_t now() const {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            std::chrono::steady_clock::now() - startTime).count());
+    }
+
+    // Thread-safe; costs one uncontended lock per scope
+    void record(int phase, uint64_t startNs, uint64_t endNs);
+
+    // Clear histograms, keeping registered phases
+    void resetStats();
+    std::vector<PhaseStats> stats() const;
+
+    // Trace capture. Stops by itself once MAX_TRACE_EVENTS are held.
+    void startCapture();
+    void stopCapture();
+    bool isCapturing() const;
+    size_t capturedEvents() const;
+
+    // Exports read the trace unlocked: call them after stopCapture() on the
+    // thread that starts and stops captures, while no capture is running.
+    // trace_event JSON ("X" complete events, microseconds); false on I/O error
+    bool writeChromeTrace(const std::string& path) const;
+    // One row per captured event: phase,start_us,duration_us,depth,thread
+    bool writeCsv(const std::string& path) const;
+
+private:
+    struct Phase {
+        const char* name = nullptr;
+        LatencyHistogram histogram;
+    };
+
+    struct TraceEvent {
+        uint64_t startNs;
+        uint32_t durationNs;
+        uint16_t phase;
+        uint8_t depth;
+        uint8_t thread;
+    };
+
+    Profiler() : startTime(std::chrono::steady_clock::now()) {}
+
+    static inline thread_local bool threadAttached = false;
+    static inline thread_local uint16_t depth = 0;
+    static inline thread_local uint8_t threadId = 0;
+    static inline std::atomic<uint8_t> nextThreadId{1};
+
+    friend class ProfileScope;
+
+    std::chrono::steady_clock::time_point startTime;
+    std::array<Phase, MAX_PHASES> phases;
+    // Phases below the count are complete; registration writes the next
+    // one under the lock, then publishes it by raising the count
+    std::atomic<size_t> phaseCount{0};
+    std::mutex registerMutex;
+    // Guards the histograms, events and capturing
+    mutable std::mutex recordMutex;
+    std::vector<TraceEvent> events;
+    bool capturing = false;
+};
+
+// Times its own lifetime into a phase
+class ProfileScope {
+public:
+    explicit ProfileScope(int phase) : phase(phase) {
+        if (Profiler::threadAttached && phase >= 0) {
+            ++Profiler::depth;
+            start = Profiler::instance().now();
+        }
+    }
+
+    ~ProfileScope() {
+        if (start != NOT_STARTED) {
+            --Profiler::depth;
+            Profiler::instance().record(phase, start, Profiler::instance().now());
+        }
+    }
+
+    ProfileScope(const ProfileScope&) = delete;
+    ProfileScope& operator=(const ProfileScope&) = delete;
+
+private:
+    static constexpr uint64_t NOT_STARTED = ~uint64_t(0);
+    int phase;
+    uint64_t start = NOT_STARTED;
+};
+
+#define ASTEROIDS_PROFILE_CONCAT_(a, b) a##b
+#define ASTEROIDS_PROFILE_CONCAT(a, b) ASTEROIDS_PROFILE_CONCAT_(a, b)
+
+#if ASTEROIDS_PROFILE
+#define PROFILE_SCOPE(name) \
+    static const int ASTEROIDS_PROFILE_CONCAT(profilePhase_, __LINE__) = \
+        Profiler::instance().registerPhase(name); \
+    ProfileScope ASTEROIDS_PROFILE_CONCAT(profileScope_, __LINE__)( \
+        ASTEROIDS_PROFILE_CONCAT(profilePhase_, __LINE__))
+#else
+#define PROFILE_SCOPE(name) ((void)0)
+#endif
@@ -0,0 +1,77 @@
+// include/Random.hpp
+#pragma once
+#include <cstdint>
+#include <limits>
+
+// Small, fast, seedable generator (xoshiro128**). Each GameState owns one, so
+// a world's randomness depends only on its seed and never on other worlds.
+// Satisfies UniformRandomBitGenerator, so <random> distributions work too,
+// but the helpers below are cheaper on the hot paths.
+class Random {
+public:
+    using result_type = uint32_t;
+
+    explicit Random(uint64_t seed = 0) { reseed(seed); }
+
+    // Expand the seed with splitmix64 so nearby seeds give unrelated streams
+    void reseed(uint64_t seed) {
+        for (int i = 0; i < 4; i += 2) {
+            uint64_t z = (seed += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            z ^= z >> 31;
+            state[i] = static_cast<uint32_t>(z);
+            state[i + 1] = static_cast<uint32_t>(z >> 32);
+        }
+    }
+
+    // Raw generator state, for snapshots
+    struct State {
+        uint32_t words[4];
+    };
+
+    State getState() const { return State{{state[0], state[1], state[2], state[3]}}; }
+    void setState(const State& saved) {
+        for (int i = 0; i < 4; ++i) state[i] = saved.words[i];
+    }
+
+    uint32_t next() {
+        const uint32_t result = rotl(state[1] * 5, 7) * 9;
+        const uint32_t t = state[1] << 9;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 11);
+        return result;
+    }
+
+    result_type operator()() { return next(); }
+    static constexpr result_type min() { return 0; }
+    static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+    // Uniform in [0, 1)
+    float nextFloat() {
+        return static_cast<float>(next() >> 8) * (1.0f / 16777216.0f);
+    }
+
+    // Uniform in [low, high)
+    float uniform(float low, float high) {
+        return low + (high - low) * nextFloat();
+    }
+
+    // Uniform in [low, high], inclusive. Multiply-shift range reduction;
+    // the bias is negligible for the small ranges used here.
+    int range(int low, int high) {
+        uint64_t span = static_cast<uint64_t>(static_cast<int64_t>(high) - low + 1);
+        return low + static_cast<int>((static_cast<uint64_t>(next()) * span) >> 32);
+    }
+
+    bool coinFlip() { return (next() >> 31) != 0; }
+
+private:
+    static uint32_t rotl(uint32_t x, int k) { return (x << k) | (x >> (32 - k)); }
+
+    uint32_t state[4];
+};
@@ -0,0 +1,82 @@
+// include/RenderCommandList.hpp
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <string_view>
+#include <vector>
+
+// One frame's drawing as plain data, in world coordinates. draw() methods
+// append to a list; a backend replays it (BatchRenderer for SFML,
+// HeadlessRenderer for counting and hashing without a window). clear()
+// keeps every buffer's capacity, so a reused list stops allocating.
+class RenderCommandList {
+public:
+    enum class Kind : uint8_t {
+        LineLoop,   // Closed line strip through count points
+        Triangles,  // count / 3 filled triangles
+        Circle,     // Filled circle at position with radius
+        Text,       // count characters of text() at position
+        Lines,      // count / 2 separate segments through vertices(), each
+                    // vertex with its own colour
+    };
+
+    // Fixed size and free of padding, so frames hash byte for byte
+    struct Command {
+        Kind kind;
+        uint8_t characterSize;      // Text only
+        uint8_t centered;           // Text only: position is the centre, not the top left
+        uint8_t reserved;
+        sf::Color color;
+        uint32_t first;             // Into points(), text() for Text, vertices() for Lines
+        uint32_t count;             // Points, characters or vertices
+        sf::Vector2f position;      // Circle centre or text anchor
+        float radius;               // Circle only
+    };
+
+    void clear() {
+        commandBuffer.clear();
+        pointBuffer.clear();
+        textBuffer.clear();
+        vertexBuffer.clear();
+    }
+
+    // Closed outline through local-space points, rotated (degrees) about
+    // the local origin and then moved to position
+    void addOutline(const sf::Vector2f* points, size_t count,
+                    const sf::Vector2f& position, float rotation, const sf::Color& color);
+
+    // Filled convex polygon, same transform as addOutline, stored as a triangle fan
+    void addPolygon(const sf::Vector2f* points, size_t count,
+                    const sf::Vector2f& position, float rotation, const sf::Color& color);
+
+    void addCircle(const sf::Vector2f& center, float radius, const sf::Color& color);
+
+    void addText(std::string_view text, const sf::Vector2f& position, unsigned characterSize,
+                 const sf::Color& color, bool centered = false);
+
+    // Reserve vertexCount coloured vertices for the caller to fill, two per
+    // segment. The pointer is valid until the next add.
+    sf::Vertex* addLines(size_t vertexCount);
+
+    const std::vector<Command>& commands() const { return commandBuffer; }
+    const std::vector<sf::Vector2f>& points() const { return pointBuffer; }
+    const std::vector<sf::Vertex>& vertices() const { return vertexBuffer; }
+    std::string_view text(const Command& command) const {
+        return std::string_view(textBuffer.data() + command.first, command.count);
+    }
+
+    bool empty() const { return commandBuffer.empty(); }
+
+    // FNV-style hash over every command, point, vertex and character. Equal frames
+    // hash equal; any moved vertex, colour or string changes the hash.
+    uint64_t hash() const;
+
+private:
+    Command& push(Kind kind, const sf::Color& color, uint32_t first, uint32_t count);
+
+    std::vector<Command> commandBuffer;
+    std::vector<sf::Vector2f> pointBuffer;
+    std::vector<char> textBuffer;
+    std::vector<sf::Vertex> vertexBuffer;
+};
@@ -0,0 +1,121 @@
+// include/RenderSnapshot.hpp
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+#include "Asteroid.hpp"
+#include "BatchRenderer.hpp"
+#include "RenderCommandList.hpp"
+#include "Hud.hpp"
+#include "ParticleSystem.hpp"
+#include "Profiler.hpp"
+#include "Random.hpp"
+
+// Percentiles of a thread's frame or tick times, in milliseconds
+struct FrameStats {
+    uint64_t count = 0;
+    float p50Ms = 0.0f;
+    float p99Ms = 0.0f;
+    float maxMs = 0.0f;
+
+    static FrameStats summarize(const LatencyHistogram& nanoseconds) {
+        return FrameStats{nanoseconds.count(), nanoseconds.percentile(0.50) * 1e-6f,
+                          nanoseconds.percentile(0.99) * 1e-6f, nanoseconds.max() * 1e-6f};
+    }
+};
+
+// Everything needed to draw one simulation state, copied out of GameState so
+// it can be drawn without touching the simulation, possibly on another
+// thread. Each object keeps its previous and current pose for interpolation.
+// clear() keeps capacity, so refilling a snapshot every tick does not allocate.
+struct RenderSnapshot {
+    struct Pose {
+        sf::Vector2f previousPosition;
+        sf::Vector2f position;
+        float previousRotation;
+        float rotation;
+    };
+
+    struct AsteroidView {
+        Pose pose;
+        Asteroid::Size size;
+        uint16_t shapeIndex;
+    };
+
+    // Something destroyed at the end of the given tick
+    struct Explosion {
+        sf::Vector2f position;
+        sf::Vector2f velocity;
+        float radius;
+        uint64_t tick;
+    };
+
+    bool hasShip = false;
+    bool thrusting = false;
+    Pose ship{};
+    std::vector<Pose> bullets;           // Rotation unused
+    std::vector<AsteroidView> asteroids;
+    // Those of the last few ticks, oldest first, so a renderer that misses
+    // a snapshot or two still sees them all
+    std::vector<Explosion> explosions;
+
+    sf::Vector2f worldSize{WINDOW_WIDTH, WINDOW_HEIGHT};  // Wrap size, for interpolation
+    int score = 0;
+    Hud::Phase phase = Hud::Phase::Playing;
+
+    uint64_t tick = 0;          // Ticks simulated so far
+    float tickStep = 1.0f / SIMULATION_TICK_RATE;
+
+    // Set by whoever publishes the snapshot: the wall time the current
+    // poses belong to, and the simulation's tick times
+    std::chrono::steady_clock::time_point simulatedAt{};
+    FrameStats simulation;
+
+    void clear() {
+        hasShip = false;
+        bullets.clear();
+        asteroids.clear();
+        explosions.clear();
+    }
+};
+
+// Turns RenderSnapshots into frames: entity geometry, effect particles and
+// the HUD. Particles are purely visual and live here, not in the simulation;
+// they run on the snapshots' clock, so replays draw identical frames.
+class SnapshotRenderer {
+public:
+    // The font must outlive the renderer
+    void setFont(const sf::Font& font) { backend.setFont(font); }
+
+    // Append the frame to out. alpha blends each object from its previous
+    // pose (0) to its current one (1). Advances the particles to the
+    // snapshot's time, emitting any effects it brings.
+    void record(const RenderSnapshot& snapshot, float alpha, RenderCommandList& out);
+
+    // Record into the renderer's own list and submit it through SFML
+    void draw(sf::RenderTarget& target, const RenderSnapshot& snapshot, float alpha);
+
+    // The frame recorded by the last draw()
+    const RenderCommandList& getCommands() const { return commands; }
+    int getDrawCalls() const { return backend.getDrawCalls(); }
+    int getHudRebuilds() const { return hud.getFrameRebuilds(); }
+    const ParticleSystem& getParticles() const { return particles; }
+
+    static constexpr size_t PARTICLE_CAPACITY = 1 << 18;
+
+private:
+    void updateParticles(const RenderSnapshot& snapshot, float alpha);
+    void emitDebris(const RenderSnapshot::Explosion& explosion);
+    void emitExhaust(const sf::Vector2f& position, float rotation, float deltaTime);
+
+    RenderCommandList commands;
+    BatchRenderer backend;
+    Hud hud;
+
+    ParticleSystem particles;   // Allocated on first use, so worlds never drawn don't pay for it
+    Random effectsRng{0x5eed};
+    double particleTime = 0.0;  // Seconds of simulation the particles have reached
+    uint64_t effectsTick = 0;   // Explosions up to this tick have been emitted
+    float exhaustOwed = 0.0f;   // Fraction of an exhaust particle carried to the next frame
+};
@@ -1,49 +1,52 @@
 // include/Ship.hpp
 #pragma once
 #include <SFML/Graphics.hpp>
+#include <algorithm>
 #include <cmath>
 #include "GameObject.hpp"
 #include "GameObjectManager.hpp"
 #include "Bullet.hpp"
 #include "Constants.hpp"
+#include "InputSource.hpp"
+#include "Profiler.hpp"
+#include "Vector2D.hpp"
 
-class Ship : public GameObject {
+class Ship final : public GameObject {
 public:
-    Ship() {
+    // Ship state for snapshots. Bullets are saved separately, and input is
+    // set afresh before every update so it isn't included.
+    struct State {
+        Body body;
+        float rotation;
+        float previousRotation;
+        bool thrusting;
+        bool wasFirePressed;
+        uint16_t reserved;          // Keeps the layout free of padding
+        float fireCooldown;         // Seconds until held fire shoots again
+    };
 
-        float scale = SHIP_SCALE;
+    // Speeds, bullet cap and world size come from config, which must outlive the ship
+    explicit Ship(const WorldConfig& config = WorldConfig::defaults()) {
+        this->config = &config;
 
-        // Create the ship shape
-        shape.setPointCount(3);
-        shape.setPoint(0, sf::Vector2f(0.0f * scale, -20.0f * scale));     // Top point
-        shape.setPoint(1, sf::Vector2f(-15.0f * scale, 20.0f * scale));    // Bottom left
-        shape.setPoint(2, sf::Vector2f(15.0f * scale, 20.0f * scale));     // Bottom right
-        
-        // Set initial properties
-        shape.setFillColor(sf::Color::Transparent);
-        shape.setOutlineColor(sf::Color::White);
-        shape.setOutlineThickness(1.0f);
-        
-        // Center the origin
-        shape.setOrigin(0, 0);
-        
         // Initialize movement properties
         rotation = 0.0f;
+        previousRotation = 0.0f;
         thrusting = false;
     }
     
     void update(float deltaTime) override {
+        PROFILE_SCOPE("Ship::update");
+        savePreviousState();
+        previousRotation = rotation;
+
         handleRotation(deltaTime);
         handleThrust(deltaTime);
-        handleShooting();
+        handleShooting(deltaTime);
         
         // Update position based on velocity
         position += velocity * deltaTime;
-        wrapPosition(WINDOW_WIDTH, WINDOW_HEIGHT);
-        
-        // Update shape position and rotation
-        shape.setPosition(position);
-        shape.setRotation(rotation);
+        wrapPosition();
         
         // Update bullets and remove expired ones
         bulletManager.update(deltaTime);
@@ -54,20 +57,48 @@ public:
         });
     }
     
-    void draw(sf::RenderWindow& window) override {
-        // Draw the ship
-        window.draw(shape);
+    void draw(RenderCommandList& commands, float alpha) override {
+        drawHull(commands, getInterpolatedPosition(alpha),
+                 lerp(previousRotation, rotation, alpha), thrusting);
+        
+        // Draw all bullets
+        bulletManager.draw(commands, alpha);
+    }
+
+    // The ship without its bullets; also used to draw from render snapshots
+    static void drawHull(RenderCommandList& commands, const sf::Vector2f& renderPosition,
+                         float renderRotation, bool thrusting) {
+        static const sf::Vector2f hull[] = {
+            sf::Vector2f(0.0f * SHIP_SCALE, -20.0f * SHIP_SCALE),     // Top point
+            sf::Vector2f(-15.0f * SHIP_SCALE, 20.0f * SHIP_SCALE),    // Bottom left
+            sf::Vector2f(15.0f * SHIP_SCALE, 20.0f * SHIP_SCALE),     // Bottom right
+        };
+        commands.addOutline(hull, 3, renderPosition, renderRotation, sf::Color::White);
         
         // Draw thrust flame when thrusting
         if (thrusting) {
-            drawThrustFlame(window);
+            drawThrustFlame(commands, renderPosition, renderRotation);
         }
-        
-        // Draw all bullets
-        bulletManager.draw(window);
     }
     
     float getRadius() const { return 20.0f * SHIP_SCALE; }
+
+    State getState() const {
+        return State{getBody(), rotation, previousRotation, thrusting, wasFirePressed, 0,
+                     fireCooldown};
+    }
+
+    void setState(const State& state) {
+        setBody(state.body);
+        rotation = state.rotation;
+        previousRotation = state.previousRotation;
+        thrusting = state.thrusting;
+        wasFirePressed = state.wasFirePressed;
+        fireCooldown = state.fireCooldown;
+    }
+
+    // Controls to apply on the next update
+    void setInput(const InputState& state) { input = state; }
     
     // Bullet manager access
     const GameObjectManager<Bullet>& getBulletManager() const { return bulletManager; }
@@ -75,89 +106,66 @@ public:
 
 private:
     void handleRotation(float deltaTime) {
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::J)) {
-            rotation -= SHIP_ROTATION_SPEED * deltaTime;
+        if (input.rotateLeft) {
+            rotation -= config->shipRotationSpeed * deltaTime;
         }
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::L)) {
-            rotation += SHIP_ROTATION_SPEED * deltaTime;
+        if (input.rotateRight) {
+            rotation += config->shipRotationSpeed * deltaTime;
         }
     }
     
     void handleThrust(float deltaTime) {
-        thrusting = sf::Keyboard::isKeyPressed(sf::Keyboard::K);
+        thrusting = input.thrust;
         
         if (thrusting) {
-            // Convert rotation to radians for calculating direction
-            float rotationRad = rotation * M_PI / 180.0f;
-            
-            // Calculate thrust direction based on current rotation
-            sf::Vector2f thrustDir(
-                std::sin(rotationRad),
-                -std::cos(rotationRad)  // Negative because y-axis is down in SFML
-            );
-            
-            // Apply acceleration in the thrust direction
-            velocity += thrustDir * SHIP_ACCELERATION * deltaTime;
-            
-            // Limit speed
-            float currentSpeed = std::sqrt(velocity.x * velocity.x + velocity.y * velocity.y);
-            if (currentSpeed > SHIP_MAX_SPEED) {
-                velocity *= SHIP_MAX_SPEED / currentSpeed;
-            }
+            // Accelerate the way the ship faces, up to its top speed
+            Vec2 thrustDir = vec2::heading(rotation);
+            velocity = vec2::clampLength(Vec2(velocity) + thrustDir * config->shipAcceleration * deltaTime,
+                                         config->shipMaxSpeed);
         }
         
         // Apply drag
         velocity *= DRAG_COEFFICIENT;
     }
     
-    void handleShooting() {
-        static bool wasSpacePressed = false;
-        bool isSpacePressed = sf::Keyboard::isKeyPressed(sf::Keyboard::Space);
-        
-        // Only shoot on initial key press, not hold
-        if (isSpacePressed && !wasSpacePressed) {
+    void handleShooting(float deltaTime) {
+        // Shoot on the initial key press; holding only repeats with a fire interval
+        fireCooldown = std::max(0.0f, fireCooldown - deltaTime);
+        bool repeat = config->fireInterval > 0.0f && fireCooldown <= 0.0f;
+        if (input.fire && (!wasFirePressed || repeat)) {
             fireBullet();
+            fireCooldown = config->fireInterval;
         }
         
-        wasSpacePressed = isSpacePressed;
+        wasFirePressed = input.fire;
     }
     
     void fireBullet() {
-        if (bulletManager.count() >= MAX_BULLETS) return;
+        if (bulletManager.count() >= static_cast<size_t>(config->maxBullets)) return;
         
-        // Calculate bullet start position (at ship's nose)
-        float rotationRad = rotation * M_PI / 180.0f;
-        sf::Vector2f bulletPos = position + sf::Vector2f(
-            std::sin(rotationRad) * 20.0f,  // 20 pixels from center (ship height)
-            -std::cos(rotationRad) * 20.0f
-        );
+        // Calculate bullet start position (at ship's nose, 20 pixels from center)
+        sf::Vector2f bulletPos = position + sf::Vector2f(vec2::heading(rotation) * 20.0f);
         
         // Create and spawn new bullet
-        auto bullet = std::make_unique<Bullet>(bulletPos, rotation);
-        bulletManager.spawn(std::move(bullet));
+        bulletManager.spawn(bulletPos, rotation, *config);
     }
     
-    void drawThrustFlame(sf::RenderWindow& window) {
-        sf::ConvexShape flame;
-        flame.setPointCount(3);
-        float scale = SHIP_SCALE;
-        
-        // Calculate flame points relative to ship's back
-        flame.setPoint(0, sf::Vector2f(-8.0f * scale, 22.0f * scale));    // Left point
-        flame.setPoint(1, sf::Vector2f(8.0f * scale, 22.0f * scale));     // Right point
-        flame.setPoint(2, sf::Vector2f(0.0f * scale, 35.0f * scale));     // Bottom point
-        
-        flame.setFillColor(sf::Color::Yellow);
-        flame.setOrigin(0, 0);
-        flame.setPosition(position);
-        flame.setRotation(rotation);
-        
-        window.draw(flame);
+    static void drawThrustFlame(RenderCommandList& commands, const sf::Vector2f& renderPosition, float renderRotation) {
+        // Flame points relative to ship's back
+        static const sf::Vector2f flame[] = {
+            sf::Vector2f(-8.0f * SHIP_SCALE, 22.0f * SHIP_SCALE),    // Left point
+            sf::Vector2f(8.0f * SHIP_SCALE, 22.0f * SHIP_SCALE),     // Right point
+            sf::Vector2f(0.0f * SHIP_SCALE, 35.0f * SHIP_SCALE),     // Bottom point
+        };
+        commands.addPolygon(flame, 3, renderPosition, renderRotation, sf::Color::Yellow);
     }
     
-    sf::ConvexShape shape;
     float rotation;
+    float previousRotation;
     bool thrusting;
+    InputState input;
+    bool wasFirePressed = false;
+    float fireCooldown = 0.0f;
     
     // Bullet management using double buffer system
     GameObjectManager<Bullet> bulletManager;
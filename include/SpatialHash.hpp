@@ -0,0 +1,134 @@
+// include/SpatialHash.hpp
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+// Uniform grid broadphase over a toroidal world.
+//
+// Objects are inserted by centre point; the grid is rebuilt once per tick with
+// a counting sort so that every cell's entries are contiguous. Queries walk the
+// cells overlapping a circle grown by the largest inserted radius, wrapping
+// cell coordinates so objects near one edge find objects on the opposite edge.
+class SpatialHash {
+public:
+    SpatialHash(float worldWidth, float worldHeight, float cellSize) {
+        configure(worldWidth, worldHeight, cellSize);
+    }
+
+    // Resize the grid. Cells are stretched so a whole number fits the world.
+    void configure(float worldWidth, float worldHeight, float cellSize) {
+        columns = std::max(1, static_cast<int>(worldWidth / cellSize));
+        rows = std::max(1, static_cast<int>(worldHeight / cellSize));
+        cellWidth = worldWidth / columns;
+        cellHeight = worldHeight / rows;
+        cellStart.assign(static_cast<size_t>(columns) * rows + 1, 0);
+        clear();
+    }
+
+    void clear() {
+        staged.clear();
+        entries.clear();
+        maxRadius = 0.0f;
+    }
+
+    // Stage an object for the next build()
+    void insert(uint32_t id, const sf::Vector2f& position, float radius) {
+        staged.push_back({id, cellOf(position)});
+        maxRadius = std::max(maxRadius, radius);
+    }
+
+    // Staging from several threads: reserve count empty slots, then fill
+    // any of them from any thread with stageAt() and report the largest
+    // radius once. Slots left empty are skipped. build() lists a cell's
+    // objects in slot order, as if they had been inserted in that order.
+    void resizeStaged(size_t count) { staged.assign(count, StagedEntry{0, EMPTY_SLOT}); }
+    void stageAt(size_t slot, uint32_t id, const sf::Vector2f& position) {
+        staged[slot] = {id, cellOf(position)};
+    }
+    void growMaxRadius(float radius) { maxRadius = std::max(maxRadius, radius); }
+
+    // Bucket all staged objects by cell
+    void build() {
+        std::fill(cellStart.begin(), cellStart.end(), 0);
+        size_t count = 0;
+        for (const auto& entry : staged) {
+            if (entry.cell == EMPTY_SLOT) continue;
+            ++cellStart[entry.cell + 1];
+            ++count;
+        }
+        for (size_t i = 1; i < cellStart.size(); ++i) {
+            cellStart[i] += cellStart[i - 1];
+        }
+
+        entries.resize(count);
+        cursor.assign(cellStart.begin(), cellStart.end() - 1);
+        for (const auto& entry : staged) {
+            if (entry.cell == EMPTY_SLOT) continue;
+            entries[cursor[entry.cell]++] = entry.id;
+        }
+    }
+
+    // Call fn(id) for every object whose cell may overlap the given circle.
+    // Each candidate is visited at most once; the caller runs the narrowphase.
+    template<typename Fn>
+    void query(const sf::Vector2f& position, float radius, Fn&& fn) const {
+        if (entries.empty()) return;
+
+        float reach = radius + maxRadius;
+        int firstColumn = static_cast<int>(std::floor((position.x - reach) / cellWidth));
+        int lastColumn = static_cast<int>(std::floor((position.x + reach) / cellWidth));
+        int firstRow = static_cast<int>(std::floor((position.y - reach) / cellHeight));
+        int lastRow = static_cast<int>(std::floor((position.y + reach) / cellHeight));
+
+        // Never walk the same wrapped cell twice
+        lastColumn = std::min(lastColumn, firstColumn + columns - 1);
+        lastRow = std::min(lastRow, firstRow + rows - 1);
+
+        for (int row = firstRow; row <= lastRow; ++row) {
+            int wrappedRow = wrap(row, rows);
+            for (int column = firstColumn; column <= lastColumn; ++column) {
+                int cell = cellIndex(wrap(column, columns), wrappedRow);
+                for (uint32_t i = cellStart[cell]; i < cellStart[cell + 1]; ++i) {
+                    fn(entries[i]);
+                }
+            }
+        }
+    }
+
+    size_t size() const { return entries.size(); }
+    int getColumns() const { return columns; }
+    int getRows() const { return rows; }
+
+private:
+    struct StagedEntry {
+        uint32_t id;
+        int cell;
+    };
+    static constexpr int EMPTY_SLOT = -1;
+
+    static int wrap(int value, int count) {
+        int result = value % count;
+        return result < 0 ? result + count : result;
+    }
+
+    int columnOf(float x) const { return wrap(static_cast<int>(std::floor(x / cellWidth)), columns); }
+    int rowOf(float y) const { return wrap(static_cast<int>(std::floor(y / cellHeight)), rows); }
+    int cellIndex(int column, int row) const { return row * columns + column; }
+    int cellOf(const sf::Vector2f& position) const {
+        return cellIndex(columnOf(position.x), rowOf(position.y));
+    }
+
+    float cellWidth = 1.0f;
+    float cellHeight = 1.0f;
+    int columns = 1;
+    int rows = 1;
+    float maxRadius = 0.0f;
+
+    std::vector<StagedEntry> staged;
+    std::vector<uint32_t> cellStart;   // Prefix sums, one past the end per cell
+    std::vector<uint32_t> cursor;      // Scratch for the scatter pass
+    std::vector<uint32_t> entries;     // Object ids grouped by cell
+};
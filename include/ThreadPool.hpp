@@ -0,0 +1,82 @@
+// include/ThreadPool.hpp
+#pragma once
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+// Fixed set of worker threads for data-parallel loops. The calling thread
+// takes part in every loop, so a pool of N threads starts N - 1 workers.
+// One parallelFor runs at a time; calling it from inside a task deadlocks.
+class ThreadPool {
+public:
+    // 0 picks one thread per hardware core
+    explicit ThreadPool(size_t threadCount = 0);
+    ~ThreadPool();
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    // Threads that run tasks, including the caller
+    size_t size() const { return workers.size() + 1; }
+
+    // Calls fn(i) once for every i in [0, count) and returns when all calls
+    // have finished. Indices are handed out grain at a time; fn must not throw.
+    template<typename Fn>
+    void parallelFor(size_t count, Fn&& fn, size_t grain = 1) {
+        using Callable = std::remove_reference_t<Fn>;
+        dispatch(count, grain, [](void* context, size_t index) {
+            (*static_cast<Callable*>(context))(index);
+        }, const_cast<void*>(static_cast<const void*>(&fn)));
+    }
+
+    // parallelFor for an fn that may throw. Every index still runs; once
+    // all have finished, the exception from the lowest failing index is
+    // rethrown on the calling thread.
+    template<typename Fn>
+    void parallelForCatching(size_t count, Fn&& fn, size_t grain = 1) {
+        std::mutex failureMutex;
+        std::exception_ptr failure;
+        size_t failedIndex = count;
+        parallelFor(count, [&](size_t index) {
+            try {
+                fn(index);
+            } catch (...) {
+                std::lock_guard<std::mutex> lock(failureMutex);
+                if (index < failedIndex) {
+                    failedIndex = index;
+                    failure = std::current_exception();
+                }
+            }
+        }, grain);
+        if (failure) std::rethrow_exception(failure);
+    }
+
+private:
+    using TaskFn = void (*)(void* context, size_t index);
+
+    struct Job {
+        size_t count = 0;
+        size_t grain = 1;
+        TaskFn task = nullptr;
+        void* context = nullptr;
+    };
+
+    void dispatch(size_t count, size_t grain, TaskFn task, void* context);
+    void runJob(const Job& job);
+    void workerLoop();
+
+    std::vector<std::thread> workers;
+    std::mutex mutex;
+    std::condition_variable wake;
+    std::condition_variable done;
+    Job job;
+    size_t generation = 0;        // Bumped per job, guarded by mutex
+    size_t activeWorkers = 0;     // Workers still on the current job
+    bool stopping = false;
+    std::atomic<size_t> nextIndex{0};
+};
@@ -0,0 +1,47 @@
+// include/TripleBuffer.hpp
+#pragma once
+#include <atomic>
+#include <cstdint>
+
+// Lock-free single-producer, single-consumer handoff of whole values.
+//
+// The writer fills writeBuffer() and publish()es it; the reader calls
+// acquire() and then reads readBuffer(), which always holds the newest
+// published value. Neither side ever waits: the third buffer sits between
+// them, and a publish nobody read yet is simply replaced by the next one.
+// Buffers are recycled, so a T that reuses its capacity stops allocating.
+template<typename T>
+class TripleBuffer {
+public:
+    // Writer side
+    T& writeBuffer() { return slots[back].value; }
+
+    void publish() {
+        uint8_t previous = middle.exchange(back | FRESH, std::memory_order_acq_rel);
+        back = previous & INDEX;
+    }
+
+    // Reader side. True if a newer value was published since the last call.
+    bool acquire() {
+        if (!(middle.load(std::memory_order_relaxed) & FRESH)) return false;
+        uint8_t previous = middle.exchange(front, std::memory_order_acq_rel);
+        front = previous & INDEX;
+        return true;
+    }
+
+    const T& readBuffer() const { return slots[front].value; }
+
+private:
+    static constexpr uint8_t INDEX = 0x3;
+    static constexpr uint8_t FRESH = 0x4;
+
+    // Own cache lines so the two threads never share one
+    struct alignas(64) Slot {
+        T value{};
+    };
+
+    Slot slots[3];
+    alignas(64) std::atomic<uint8_t> middle{1};
+    alignas(64) uint8_t back = 0;       // Writer only
+    alignas(64) uint8_t front = 2;      // Reader only
+};
@@ -0,0 +1,102 @@
+// include/Vector2D.hpp
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cmath>
+#include <cstddef>
+
+// 2D math for game code. Vec2 is a literal type, so its arithmetic works in
+// constant expressions, and it converts to and from sf::Vector2f so helpers
+// below accept either. Angles follow the game's convention: degrees, 0
+// facing up the screen, increasing clockwise.
+struct Vec2 {
+    float x = 0.0f;
+    float y = 0.0f;
+
+    constexpr Vec2() = default;
+    constexpr Vec2(float x, float y) : x(x), y(y) {}
+    constexpr Vec2(const sf::Vector2f& v) : x(v.x), y(v.y) {}
+    operator sf::Vector2f() const { return sf::Vector2f(x, y); }
+
+    constexpr Vec2& operator+=(const Vec2& v) { x += v.x; y += v.y; return *this; }
+    constexpr Vec2& operator-=(const Vec2& v) { x -= v.x; y -= v.y; return *this; }
+    constexpr Vec2& operator*=(float s) { x *= s; y *= s; return *this; }
+    constexpr Vec2& operator/=(float s) { x /= s; y /= s; return *this; }
+};
+
+constexpr Vec2 operator+(Vec2 a, const Vec2& b) { return a += b; }
+constexpr Vec2 operator-(Vec2 a, const Vec2& b) { return a -= b; }
+constexpr Vec2 operator-(const Vec2& v) { return Vec2(-v.x, -v.y); }
+constexpr Vec2 operator*(Vec2 v, float s) { return v *= s; }
+constexpr Vec2 operator*(float s, Vec2 v) { return v *= s; }
+constexpr Vec2 operator/(Vec2 v, float s) { return v /= s; }
+constexpr bool operator==(const Vec2& a, const Vec2& b) { return a.x == b.x && a.y == b.y; }
+constexpr bool operator!=(const Vec2& a, const Vec2& b) { return !(a == b); }
+
+namespace vec2 {
+
+constexpr float dot(const Vec2& a, const Vec2& b) { return a.x * b.x + a.y * b.y; }
+// z of the 3D cross product; positive when b is clockwise of a on screen
+constexpr float cross(const Vec2& a, const Vec2& b) { return a.x * b.y - a.y * b.x; }
+constexpr float lengthSq(const Vec2& v) { return v.x * v.x + v.y * v.y; }
+
+inline float length(const Vec2& v) { return std::sqrt(lengthSq(v)); }
+
+// Unit vector along v; the zero vector stays zero
+inline Vec2 normalize(const Vec2& v) {
+    float len = length(v);
+    return len > 0.0f ? v / len : Vec2();
+}
+
+// v scaled down to maxLength if longer
+inline Vec2 clampLength(const Vec2& v, float maxLength) {
+    float len = length(v);
+    return len > maxLength ? v * (maxLength / len) : v;
+}
+
+// Rounded to float the way the call sites always have: through double
+constexpr float toRadians(float degrees) {
+    return static_cast<float>(degrees * M_PI / 180.0f);
+}
+
+struct SinCos {
+    float sin;
+    float cos;
+};
+
+// Both at once; GCC and Clang compute them in a single sincosf call
+inline SinCos sinCos(float radians) {
+    return SinCos{std::sin(radians), std::cos(radians)};
+}
+
+// Unit vector at radians from the +x axis
+inline Vec2 fromAngle(float radians) {
+    SinCos sc = sinCos(radians);
+    return Vec2(sc.cos, sc.sin);
+}
+
+// Unit vector an object facing rotation degrees points along. Screen y
+// grows downwards, so 0 degrees is (0, -1).
+inline Vec2 heading(float degrees) {
+    SinCos sc = sinCos(toRadians(degrees));
+    return Vec2(sc.sin, -sc.cos);
+}
+
+// Batch kernels over structure-of-arrays coordinates: element i is
+// (x[i], y[i]). Arrays of one call must not overlap unless stated. Results
+// match the scalar helpers above bit for bit, SIMD or not.
+void integrate(float* x, float* y, const float* vx, const float* vy, size_t count,
+               float deltaTime);
+void lengthsSq(const float* x, const float* y, float* out, size_t count);
+
+// Floats per SIMD step the kernels were built with, 1 without SIMD
+extern const size_t SIMD_WIDTH;
+
+// The same kernels one element at a time, as a reference for tests and
+// benchmarks
+namespace scalar {
+void integrate(float* x, float* y, const float* vx, const float* vy, size_t count,
+               float deltaTime);
+void lengthsSq(const float* x, const float* y, float* out, size_t count);
+} // namespace scalar
+
+} // namespace vec2
@@ -0,0 +1,55 @@
+// include/WorldBatch.hpp
+#pragma once
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <vector>
+#include "GameState.hpp"
+#include "InputSource.hpp"
+#include "ThreadPool.hpp"
+
+// Steps many independent GameStates side by side, for balancing runs and
+// bot training. Each world owns its seed, RNG and input, so worlds can be
+// stepped on any thread in any order and still produce the same results.
+class WorldBatch {
+public:
+    using InputFactory = std::function<std::unique_ptr<InputSource>(size_t worldIndex)>;
+
+    struct WorldStats {
+        long ticks = 0;
+        long gameOvers = 0;
+        long wins = 0;
+    };
+
+    // World i is seeded from baseSeed and i; makeInput is called once per
+    // world. Every world shares config, the classic world when null.
+    WorldBatch(size_t worldCount, uint32_t baseSeed, const InputFactory& makeInput,
+               std::shared_ptr<const WorldConfig> config = nullptr);
+
+    // Advance every world by ticks fixed steps of deltaTime. Worlds run in
+    // parallel; a batch of one world uses the pool for its collisions.
+    void step(ThreadPool& pool, long ticks, float deltaTime);
+
+    size_t size() const { return worlds.size(); }
+    const GameState& getWorld(size_t index) const { return *worlds[index].state; }
+    const WorldStats& getStats(size_t index) const { return worlds[index].stats; }
+
+    // Sums over all worlds
+    long totalTicks() const;
+    long totalGameOvers() const;
+    long totalWins() const;
+    long totalScore() const;
+
+    static uint32_t worldSeed(uint32_t baseSeed, size_t worldIndex);
+
+private:
+    // Own cache line each, so per-world counters never false-share
+    struct alignas(64) World {
+        std::unique_ptr<GameState> state;
+        WorldStats stats;
+    };
+
+    static void stepWorld(World& world, long ticks, float deltaTime);
+
+    std::vector<World> worlds;
+};
@@ -0,0 +1,71 @@
+// include/WorldConfig.hpp
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <cstdint>
+#include <string>
+#include <vector>
+#include "Constants.hpp"
+
+// Tunables for one simulated world, chosen at run time so scale scenarios
+// don't need a rebuild. Defaults reproduce the classic 800x600 game.
+// Collision radii stay compile-time: asteroid outlines are built around them.
+struct WorldConfig {
+    float width = WINDOW_WIDTH;                  // World size in pixels; edges wrap
+    float height = WINDOW_HEIGHT;
+    int asteroidCount = INITIAL_ASTEROID_COUNT;  // Large asteroids at the start of a round
+    int maxBullets = MAX_BULLETS;                // Live bullets the ship may have
+    float tickRate = SIMULATION_TICK_RATE;       // Fixed steps per second
+    int splitFanOut = 2;                         // Children spawned when an asteroid splits
+    float asteroidMinSpeed = ASTEROID_MIN_SPEED;
+    float asteroidMaxSpeed = ASTEROID_MAX_SPEED;
+    float shipRotationSpeed = SHIP_ROTATION_SPEED;
+    float shipAcceleration = SHIP_ACCELERATION;
+    float shipMaxSpeed = SHIP_MAX_SPEED;
+    float bulletSpeed = BULLET_SPEED;
+    float fireInterval = 0.0f;                   // Seconds between shots while fire is held;
+                                                 // 0 fires once per press
+
+    sf::Vector2f size() const { return sf::Vector2f(width, height); }
+    float tickStep() const { return 1.0f / tickRate; }
+
+    // Shared by objects created without a config of their own
+    static const WorldConfig& defaults();
+
+    // Built-in scenarios: classic, 10k, 100k, 1m, bullet-hell.
+    // Throws std::invalid_argument for unknown names.
+    static WorldConfig preset(const std::string& name);
+    static const std::vector<std::string>& presetNames();
+
+    // Reads "key = value" lines over the defaults; '#' starts a comment.
+    // Throws std::runtime_error naming the file and line on any error.
+    static WorldConfig fromFile(const std::string& path);
+
+    // Set one field by its file key. Throws std::invalid_argument for
+    // unknown keys and unparsable values.
+    void set(const std::string& key, const std::string& value);
+    // "key=value", as given to --set
+    void apply(const std::string& assignment);
+
+    // Beyond these the asteroid grid alone would need gigabytes
+    static constexpr float MAX_WORLD_SIDE = 1.0e6f;
+    static constexpr double MAX_GRID_CELLS = 16.0 * 1024 * 1024;
+
+    // Throws std::invalid_argument if the world can't be simulated: any
+    // float that isn't finite, or a world too large for its grid
+    void validate() const;
+
+    // Command-line handling shared by the game and the headless runner:
+    // consumes --config FILE, --preset NAME or --set key=value at argv[i],
+    // moving i onto the value. The first two replace the whole config, so
+    // give them before any --set. Returns false if argv[i] is none of these;
+    // throws like fromFile() and set() on bad values.
+    static bool parseArgument(int argc, char* argv[], int& i, WorldConfig& config);
+    static const char* usage();
+
+    // One "key = value" line per field, readable by fromFile()
+    std::string toString() const;
+
+    // FNV-1a over every field's exact bits; recordings store it so a replay
+    // can tell it was given the wrong world
+    uint32_t hash() const;
+};
@@ -0,0 +1,42 @@
+// src/Asteroid.cpp
+#include "Asteroid.hpp"
+#include <cmath>
+#include "Vector2D.hpp"
+
+namespace {
+
+constexpr Asteroid::Size ALL_SIZES[] = {
+    Asteroid::Size::Small, Asteroid::Size::Medium, Asteroid::Size::Large
+};
+
+// Jagged circles: 6-8, 8-10 or 10-12 vertices at 80-120% of the size's radius
+struct ShapeLibrary {
+    Asteroid::Shape shapes[3][Asteroid::SHAPES_PER_SIZE];
+
+    ShapeLibrary() {
+        Random rng(0xA57E401Du);  // Fixed, so every run and world sees the same outlines
+        for (Asteroid::Size size : ALL_SIZES) {
+            int minVertices = (size == Asteroid::Size::Small) ? 6 : (size == Asteroid::Size::Medium) ? 8 : 10;
+            float radius = Asteroid::getRadius(size);
+
+            for (Asteroid::Shape& shape : shapes[static_cast<int>(size)]) {
+                int vertices = rng.range(minVertices, minVertices + 2);
+                shape.pointCount = static_cast<uint8_t>(vertices);
+                shape.points.fill(sf::Vector2f());
+
+                for (int i = 0; i < vertices; ++i) {
+                    float angle = (i * 2 * M_PI) / vertices;
+                    float radiusVariation = radius * rng.uniform(0.8f, 1.2f) * ASTEROID_SCALE;
+                    shape.points[i] = vec2::fromAngle(angle) * radiusVariation;
+                }
+            }
+        }
+    }
+};
+
+} // namespace
+
+const Asteroid::Shape& Asteroid::getShape(Size size, uint16_t index) {
+    static const ShapeLibrary library;
+    return library.shapes[static_cast<int>(size)][index % SHAPES_PER_SIZE];
+}
@@ -0,0 +1,106 @@
+// src/AsteroidField.cpp
+#include "AsteroidField.hpp"
+#include "Vector2D.hpp"
+
+size_t AsteroidField::add(const Asteroid& asteroid) {
+    positionX.push_back(asteroid.getPosition().x);
+    positionY.push_back(asteroid.getPosition().y);
+    velocityX.push_back(asteroid.getVelocity().x);
+    velocityY.push_back(asteroid.getVelocity().y);
+    rotation.push_back(asteroid.getRotation());
+    rotationSpeed.push_back(asteroid.getRotationSpeed());
+    radius.push_back(asteroid.getRadius());
+    size_.push_back(static_cast<uint8_t>(asteroid.getSize()));
+
+    shapeIndex.push_back(asteroid.getShapeIndex());
+
+    return size() - 1;
+}
+
+void AsteroidField::removeSwap(size_t index) {
+    size_t last = size() - 1;
+    positionX[index] = positionX[last];
+    positionY[index] = positionY[last];
+    velocityX[index] = velocityX[last];
+    velocityY[index] = velocityY[last];
+    rotation[index] = rotation[last];
+    rotationSpeed[index] = rotationSpeed[last];
+    radius[index] = radius[last];
+    size_[index] = size_[last];
+    shapeIndex[index] = shapeIndex[last];
+
+    positionX.pop_back();
+    positionY.pop_back();
+    velocityX.pop_back();
+    velocityY.pop_back();
+    rotation.pop_back();
+    rotationSpeed.pop_back();
+    radius.pop_back();
+    size_.pop_back();
+    shapeIndex.pop_back();
+}
+
+void AsteroidField::clear() {
+    positionX.clear();
+    positionY.clear();
+    velocityX.clear();
+    velocityY.clear();
+    rotation.clear();
+    rotationSpeed.clear();
+    radius.clear();
+    size_.clear();
+    shapeIndex.clear();
+}
+
+void AsteroidField::reserve(size_t count) {
+    positionX.reserve(count);
+    positionY.reserve(count);
+    velocityX.reserve(count);
+    velocityY.reserve(count);
+    rotation.reserve(count);
+    rotationSpeed.reserve(count);
+    radius.reserve(count);
+    size_.reserve(count);
+    shapeIndex.reserve(count);
+}
+
+void AsteroidField::update(float deltaTime) {
+    const size_t count = size();
+    const float width = worldWidth;
+    const float height = worldHeight;
+
+    // Separate restrict-qualified loops so each one vectorises on its own.
+    // The wrap mirrors GameObject::wrapPosition exactly, written as selects.
+    vec2::integrate(positionX.data(), positionY.data(), velocityX.data(), velocityY.data(),
+                    count, deltaTime);
+
+    float* __restrict px = positionX.data();
+    for (size_t i = 0; i < count; ++i) {
+        float x = px[i];
+        x = x < 0.0f ? width : x;
+        x = x > width ? 0.0f : x;
+        px[i] = x;
+    }
+
+    float* __restrict py = positionY.data();
+    for (size_t i = 0; i < count; ++i) {
+        float y = py[i];
+        y = y < 0.0f ? height : y;
+        y = y > height ? 0.0f : y;
+        py[i] = y;
+    }
+
+    float* __restrict rot = rotation.data();
+    const float* __restrict spin = rotationSpeed.data();
+    for (size_t i = 0; i < count; ++i) {
+        rot[i] += spin[i] * deltaTime;
+    }
+}
+
+void AsteroidField::draw(RenderCommandList& commands) const {
+    for (size_t i = 0; i < size(); ++i) {
+        const Asteroid::Shape& shape = Asteroid::getShape(getSize(i), shapeIndex[i]);
+        commands.addOutline(shape.points.data(), shape.pointCount,
+                         sf::Vector2f(positionX[i], positionY[i]), rotation[i], sf::Color::White);
+    }
+}
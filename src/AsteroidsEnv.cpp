@@ -0,0 +1,102 @@
+// src/AsteroidsEnv.cpp
+#include "AsteroidsEnv.h"
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include "EnvBatch.hpp"
+#include "ThreadPool.hpp"
+#include "WorldConfig.hpp"
+
+static_assert(ASTEROIDS_ACTION_ROTATE_LEFT == EnvBatch::ROTATE_LEFT &&
+              ASTEROIDS_ACTION_ROTATE_RIGHT == EnvBatch::ROTATE_RIGHT &&
+              ASTEROIDS_ACTION_THRUST == EnvBatch::THRUST &&
+              ASTEROIDS_ACTION_FIRE == EnvBatch::FIRE,
+              "C action bits must match EnvBatch");
+
+struct AsteroidsEnv {
+    AsteroidsEnv(size_t threads, size_t count, const EnvBatch::Options& options)
+        : pool(threads), batch(count, options) {}
+
+    ThreadPool pool;
+    EnvBatch batch;
+};
+
+namespace {
+thread_local std::string lastError;
+
+// Exceptions must not cross the C boundary: run fn, recording any failure
+// for asteroids_env_last_error(). 0 on success, -1 on failure.
+template<typename Fn>
+int guarded(Fn&& fn) {
+    try {
+        fn();
+        lastError.clear();
+        return 0;
+    } catch (const std::exception& e) {
+        lastError = e.what();
+    } catch (...) {
+        lastError = "Unknown error";
+    }
+    return -1;
+}
+} // namespace
+
+extern "C" {
+
+AsteroidsEnv* asteroids_env_create(size_t env_count, uint32_t seed, const char* preset,
+                                   size_t threads) {
+    AsteroidsEnv* env = nullptr;
+    guarded([&] {
+        EnvBatch::Options options;
+        options.seed = seed;
+        options.config = std::make_shared<const WorldConfig>(
+            preset ? WorldConfig::preset(preset) : WorldConfig::defaults());
+        env = new AsteroidsEnv(threads, env_count, options);
+    });
+    return env;
+}
+
+void asteroids_env_destroy(AsteroidsEnv* env) {
+    delete env;
+}
+
+const char* asteroids_env_last_error(void) {
+    return lastError.c_str();
+}
+
+size_t asteroids_env_count(const AsteroidsEnv* env) {
+    return env->batch.size();
+}
+
+size_t asteroids_env_observation_size(const AsteroidsEnv* env) {
+    return env->batch.observationSize();
+}
+
+int asteroids_env_reset(AsteroidsEnv* env) {
+    return guarded([&] {
+        if (!env) throw std::invalid_argument("Null environment");
+        env->batch.reset(&env->pool);
+    });
+}
+
+int asteroids_env_step(AsteroidsEnv* env, const uint8_t* actions) {
+    return guarded([&] {
+        if (!env || !actions) throw std::invalid_argument("Null environment or actions");
+        env->batch.step(actions, &env->pool);
+    });
+}
+
+const float* asteroids_env_observations(const AsteroidsEnv* env) {
+    return env->batch.observations();
+}
+
+const float* asteroids_env_rewards(const AsteroidsEnv* env) {
+    return env->batch.rewards();
+}
+
+const uint8_t* asteroids_env_dones(const AsteroidsEnv* env) {
+    return env->batch.dones();
+}
+
+} // extern "C"
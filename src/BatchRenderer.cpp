@@ -0,0 +1,150 @@
+// src/BatchRenderer.cpp
+#include "BatchRenderer.hpp"
+#include <array>
+#include <cmath>
+#include "Constants.hpp"
+#include "Vector2D.hpp"
+
+namespace {
+
+// Unit circle shared by every circle command
+const std::array<sf::Vector2f, BatchRenderer::CIRCLE_SEGMENTS + 1>& unitCircle() {
+    static const auto circle = [] {
+        std::array<sf::Vector2f, BatchRenderer::CIRCLE_SEGMENTS + 1> points;
+        for (size_t i = 0; i <= BatchRenderer::CIRCLE_SEGMENTS; ++i) {
+            float angle = (i * 2 * M_PI) / BatchRenderer::CIRCLE_SEGMENTS;
+            points[i] = vec2::fromAngle(angle);
+        }
+        return points;
+    }();
+    return circle;
+}
+
+} // namespace
+
+void BatchRenderer::setFont(const sf::Font& newFont) {
+    font = &newFont;
+    // Every run must be laid out again with the new glyphs
+    textRuns.clear();
+}
+
+sf::View BatchRenderer::fitView(const sf::Vector2f& area, const sf::Vector2u& targetSize) {
+    sf::Vector2f size = area;
+    if (targetSize.x > 0 && targetSize.y > 0) {
+        float targetAspect = static_cast<float>(targetSize.x) / targetSize.y;
+        if (targetAspect > area.x / area.y) {
+            size.x = area.y * targetAspect;
+        } else {
+            size.y = area.x / targetAspect;
+        }
+    }
+    return sf::View(area / 2.0f, size);
+}
+
+void BatchRenderer::submit(const RenderCommandList& commands, sf::RenderTarget& target) {
+    drawCalls = 0;
+    textRebuilds = 0;
+    lines.clear();
+    triangles.clear();
+    appendGeometry(commands);
+
+    target.setView(fitView(worldSize, target.getSize()));
+
+    // Effects at the back, then filled geometry, so outlines stay on top
+    drawVertexLines(commands, target);
+    if (triangles.getVertexCount() > 0) {
+        target.draw(triangles);
+        ++drawCalls;
+    }
+    if (lines.getVertexCount() > 0) {
+        target.draw(lines);
+        ++drawCalls;
+    }
+
+    target.setView(fitView(sf::Vector2f(WINDOW_WIDTH, WINDOW_HEIGHT), target.getSize()));
+    if (font) {
+        drawText(commands, target);
+    }
+}
+
+void BatchRenderer::appendGeometry(const RenderCommandList& commands) {
+    const std::vector<sf::Vector2f>& points = commands.points();
+    const auto& circle = unitCircle();
+
+    for (const RenderCommandList::Command& command : commands.commands()) {
+        const sf::Vector2f* p = points.data() + command.first;
+        switch (command.kind) {
+            case RenderCommandList::Kind::LineLoop:
+                for (uint32_t i = 0; i < command.count; ++i) {
+                    lines.append(sf::Vertex(p[i], command.color));
+                    lines.append(sf::Vertex(p[(i + 1) % command.count], command.color));
+                }
+                break;
+            case RenderCommandList::Kind::Triangles:
+                for (uint32_t i = 0; i < command.count; ++i) {
+                    triangles.append(sf::Vertex(p[i], command.color));
+                }
+                break;
+            case RenderCommandList::Kind::Circle:
+                for (size_t i = 0; i < CIRCLE_SEGMENTS; ++i) {
+                    triangles.append(sf::Vertex(command.position, command.color));
+                    triangles.append(sf::Vertex(command.position + circle[i] * command.radius,
+                                                command.color));
+                    triangles.append(sf::Vertex(command.position + circle[i + 1] * command.radius,
+                                                command.color));
+                }
+                break;
+            case RenderCommandList::Kind::Text:
+            case RenderCommandList::Kind::Lines:
+                break;
+        }
+    }
+}
+
+// Already vertices in SFML's layout, so they are drawn straight from the
+// list without copying
+void BatchRenderer::drawVertexLines(const RenderCommandList& commands, sf::RenderTarget& target) {
+    const std::vector<sf::Vertex>& vertices = commands.vertices();
+    for (const RenderCommandList::Command& command : commands.commands()) {
+        if (command.kind != RenderCommandList::Kind::Lines || command.count == 0) continue;
+        target.draw(vertices.data() + command.first, command.count, sf::Lines);
+        ++drawCalls;
+    }
+}
+
+void BatchRenderer::drawText(const RenderCommandList& commands, sf::RenderTarget& target) {
+    size_t run = 0;
+    for (const RenderCommandList::Command& command : commands.commands()) {
+        if (command.kind != RenderCommandList::Kind::Text) continue;
+
+        if (run == textRuns.size()) {
+            textRuns.emplace_back();
+            textRuns.back().text.setFont(*font);
+        }
+        TextRun& slot = textRuns[run++];
+
+        // Glyph layout is the expensive part; only redo it on change
+        std::string_view string = commands.text(command);
+        bool centered = command.centered != 0;
+        if (string != slot.shown || command.characterSize != slot.characterSize ||
+            centered != slot.centered) {
+            slot.shown.assign(string.begin(), string.end());
+            slot.characterSize = command.characterSize;
+            slot.centered = centered;
+            slot.text.setCharacterSize(slot.characterSize);
+            slot.text.setString(slot.shown);
+            if (centered) {
+                sf::FloatRect bounds = slot.text.getLocalBounds();
+                slot.text.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
+            } else {
+                slot.text.setOrigin(0.f, 0.f);
+            }
+            ++textRebuilds;
+        }
+
+        slot.text.setFillColor(command.color);
+        slot.text.setPosition(command.position);
+        target.draw(slot.text);
+        ++drawCalls;
+    }
+}
@@ -0,0 +1,114 @@
+// src/DebugUtils.cpp
+#include "DebugUtils.hpp"
+#include <cstdio>
+
+namespace {
+
+const char* levelName(GameLogger::Level level) {
+    switch (level) {
+        case GameLogger::Level::Error: return "ERROR";
+        case GameLogger::Level::Warn: return "WARN ";
+        case GameLogger::Level::Info: return "INFO ";
+        case GameLogger::Level::Debug: return "DEBUG";
+        case GameLogger::Level::Trace: return "TRACE";
+    }
+    return "?    ";
+}
+
+} // namespace
+
+GameLogger::GameLogger()
+    : logFile("game_debug.log", std::ios::out | std::ios::app),
+      slots(new Slot[CAPACITY]),
+      startTime(std::chrono::steady_clock::now()) {
+    for (size_t i = 0; i < CAPACITY; ++i) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+    drainThread = std::thread(&GameLogger::drainLoop, this);
+}
+
+GameLogger::~GameLogger() {
+    running.store(false, std::memory_order_release);
+    if (drainThread.joinable()) {
+        drainThread.join();
+    }
+}
+
+void GameLogger::flush() {
+    size_t target = enqueuePosition.load(std::memory_order_acquire);
+    while (writtenPosition.load(std::memory_order_acquire) < target) {
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+}
+
+void GameLogger::drainLoop() {
+    std::string batch;
+    batch.reserve(64 * 1024);
+
+    for (;;) {
+        bool stopping = !running.load(std::memory_order_acquire);
+        size_t drained = drainBatch(batch);
+
+        if (drained == 0) {
+            if (stopping) break;
+            std::this_thread::sleep_for(std::chrono::milliseconds(2));
+        }
+    }
+}
+
+size_t GameLogger::drainBatch(std::string& batch) {
+    batch.clear();
+    size_t drained = 0;
+    char prefix[64];
+
+    for (;;) {
+        Slot& slot = slots[dequeuePosition & (CAPACITY - 1)];
+        size_t sequence = slot.sequence.load(std::memory_order_acquire);
+        if (sequence != dequeuePosition + 1) break;
+
+        const Record& record = slot.record;
+        uint64_t micros = record.timestampNs / 1000;
+        std::snprintf(prefix, sizeof(prefix), "%llu.%06llu %s ",
+                      static_cast<unsigned long long>(micros / 1000000),
+                      static_cast<unsigned long long>(micros % 1000000),
+                      levelName(record.level));
+        batch += prefix;
+        batch.append(record.text, record.length);
+
+        char value[32];
+        switch (record.kind) {
+            case ValueKind::None:
+                value[0] = '\0';
+                break;
+            case ValueKind::Signed:
+                std::snprintf(value, sizeof(value), ": %lld", static_cast<long long>(record.intValue));
+                break;
+            case ValueKind::Unsigned:
+                std::snprintf(value, sizeof(value), ": %llu", static_cast<unsigned long long>(record.uintValue));
+                break;
+            case ValueKind::Float:
+                std::snprintf(value, sizeof(value), ": %g", record.floatValue);
+                break;
+        }
+        batch += value;
+        batch += '\n';
+
+        // Hand the slot back to producers one lap ahead
+        slot.sequence.store(dequeuePosition + CAPACITY, std::memory_order_release);
+        ++dequeuePosition;
+        ++drained;
+    }
+
+    uint64_t totalDrops = dropped.load(std::memory_order_relaxed);
+    if (totalDrops > reportedDrops) {
+        batch += "[logger dropped " + std::to_string(totalDrops - reportedDrops) + " messages]\n";
+        reportedDrops = totalDrops;
+    }
+
+    if (!batch.empty() && logFile.is_open()) {
+        logFile << batch;
+        logFile.flush();
+    }
+    writtenPosition.store(dequeuePosition, std::memory_order_release);
+    return drained;
+}
@@ -0,0 +1,266 @@
+// src/EnvBatch.cpp
+#include "EnvBatch.hpp"
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <stdexcept>
+#include "CollisionManager.hpp"
+#include "WorldBatch.hpp"
+
+namespace {
+// Scratch reserved up front is capped so huge presets don't reserve
+// gigabytes for splits that may never happen
+constexpr size_t MAX_RESERVED_ASTEROIDS = 1 << 16;
+
+InputState decode(uint8_t action) {
+    InputState controls;
+    controls.rotateLeft = (action & EnvBatch::ROTATE_LEFT) != 0;
+    controls.rotateRight = (action & EnvBatch::ROTATE_RIGHT) != 0;
+    controls.thrust = (action & EnvBatch::THRUST) != 0;
+    controls.fire = (action & EnvBatch::FIRE) != 0;
+    return controls;
+}
+} // namespace
+
+EnvBatch::EnvBatch(size_t envCount, const Options& options)
+    : options(options),
+      config(options.config ? options.config : std::make_shared<const WorldConfig>()) {
+    if (envCount == 0) throw std::invalid_argument("EnvBatch needs at least one environment");
+    if (options.nearestAsteroids < 0 || options.rays < 0 || !(options.sensorRange > 0.0f) ||
+        options.ticksPerStep < 1) {
+        throw std::invalid_argument("EnvBatch options out of range");
+    }
+
+    const size_t nearest = static_cast<size_t>(options.nearestAsteroids);
+    const size_t rays = static_cast<size_t>(options.rays);
+    observationStride = SHIP_FEATURES + nearest * ASTEROID_FEATURES + rays;
+
+    for (size_t i = 0; i < rays; ++i) {
+        vec2::SinCos sc = vec2::sinCos(static_cast<float>(2.0 * M_PI * i / rays));
+        rayOffsetCos.push_back(sc.cos);
+        rayOffsetSin.push_back(sc.sin);
+    }
+
+    const size_t fanOut = static_cast<size_t>(config->splitFanOut);
+    const size_t reserved = std::min(MAX_RESERVED_ASTEROIDS,
+                                     static_cast<size_t>(config->asteroidCount) * fanOut * fanOut);
+    envs.resize(envCount);
+    for (size_t i = 0; i < envCount; ++i) {
+        Env& env = envs[i];
+        auto input = std::make_unique<ActionInput>();
+        env.input = input.get();
+        env.state = std::make_unique<GameState>(std::move(input),
+                                                WorldBatch::worldSeed(options.seed, i), config);
+        for (std::vector<float>* scratch : {&env.offsetX, &env.offsetY, &env.velocityX,
+                                            &env.velocityY, &env.radius, &env.distanceSq}) {
+            scratch->reserve(reserved);
+        }
+        env.order.reserve(reserved);
+        env.rayX.resize(rays);
+        env.rayY.resize(rays);
+    }
+
+    observationBuffer.assign(envCount * observationStride, 0.0f);
+    rewardBuffer.assign(envCount, 0.0f);
+    doneBuffer.assign(envCount, 0);
+    observe();
+}
+
+// Restarting an episode allocates, so a pooled step must not let the
+// exception escape into a worker
+template<typename Fn>
+void EnvBatch::forEachEnv(ThreadPool* pool, Fn&& fn) {
+    if (pool && envs.size() > 1) {
+        pool->parallelForCatching(envs.size(), fn);
+    } else {
+        for (size_t i = 0; i < envs.size(); ++i) fn(i);
+    }
+}
+
+void EnvBatch::reset(ThreadPool* pool) {
+    std::fill(rewardBuffer.begin(), rewardBuffer.end(), 0.0f);
+    std::fill(doneBuffer.begin(), doneBuffer.end(), 0);
+    forEachEnv(pool, [this](size_t i) {
+        envs[i].input->set(InputState{});
+        envs[i].state->reset();
+        observeEnv(i);
+    });
+}
+
+void EnvBatch::step(const uint8_t* actions, ThreadPool* pool) {
+    forEachEnv(pool, [this, actions](size_t i) { stepEnv(i, actions[i]); });
+}
+
+void EnvBatch::observe(ThreadPool* pool) {
+    forEachEnv(pool, [this](size_t i) { observeEnv(i); });
+}
+
+// Reward is the points scored, which GameState awards per asteroid size
+void EnvBatch::stepEnv(size_t index, uint8_t action) {
+    GameState& state = *envs[index].state;
+    envs[index].input->set(decode(action));
+
+    const float deltaTime = config->tickStep();
+    int reward = 0;
+    bool done = false;
+    for (int tick = 0; tick < options.ticksPerStep && !done; ++tick) {
+        const int before = state.getScore();
+        state.update(deltaTime);
+        reward += state.getScore() - before;
+        done = state.isGameOver() || state.isGameWon();
+    }
+    rewardBuffer[index] = static_cast<float>(reward);
+    doneBuffer[index] = done ? 1 : 0;
+
+    if (done) {
+        state.reset();
+    }
+    observeEnv(index);
+}
+
+void EnvBatch::observeEnv(size_t index) {
+    Env& env = envs[index];
+    float* out = observationBuffer.data() + index * observationStride;
+    const Ship* ship = env.state->getShip();
+    if (!ship) {
+        // step() resets dead worlds, so only one driven by hand gets here
+        std::fill(out, out + observationStride, 0.0f);
+        return;
+    }
+
+    const sf::Vector2f position = ship->getPosition();
+    const sf::Vector2f velocity = ship->getVelocity();
+    const Vec2 heading = vec2::heading(ship->getState().rotation);
+    const float inverseSpeed = 1.0f / config->shipMaxSpeed;
+    out[0] = position.x / config->width;
+    out[1] = position.y / config->height;
+    out[2] = velocity.x * inverseSpeed;
+    out[3] = velocity.y * inverseSpeed;
+    out[4] = heading.x;
+    out[5] = heading.y;
+
+    gatherAsteroids(env, position, velocity);
+    out += SHIP_FEATURES;
+    writeNearest(env, out);
+    out += static_cast<size_t>(options.nearestAsteroids) * ASTEROID_FEATURES;
+    writeRays(env, heading, out);
+}
+
+// One pointer-chasing pass over the asteroids; everything after it reads
+// the parallel arrays
+void EnvBatch::gatherAsteroids(Env& env, const sf::Vector2f& shipPosition,
+                               const sf::Vector2f& shipVelocity) {
+    env.offsetX.clear();
+    env.offsetY.clear();
+    env.velocityX.clear();
+    env.velocityY.clear();
+    env.radius.clear();
+
+    // Pending asteroids (a fresh field, this tick's splits) are already in
+    // play even though they join the update list only on the next tick
+    const sf::Vector2f world = config->size();
+    for (const auto* container : {&env.state->getAsteroids(), &env.state->getPendingAsteroids()}) {
+        for (const auto& asteroid : *container) {
+            if (!asteroid) continue;
+            sf::Vector2f offset = CollisionManager::wrappedDelta(shipPosition, asteroid->getPosition(), world);
+            sf::Vector2f velocity = asteroid->getVelocity() - shipVelocity;
+            env.offsetX.push_back(offset.x);
+            env.offsetY.push_back(offset.y);
+            env.velocityX.push_back(velocity.x);
+            env.velocityY.push_back(velocity.y);
+            env.radius.push_back(asteroid->getRadius());
+        }
+    }
+
+    env.distanceSq.resize(env.offsetX.size());
+    vec2::lengthsSq(env.offsetX.data(), env.offsetY.data(), env.distanceSq.data(), env.offsetX.size());
+}
+
+void EnvBatch::writeNearest(Env& env, float* out) const {
+    const size_t count = env.offsetX.size();
+    const size_t slots = static_cast<size_t>(options.nearestAsteroids);
+    const size_t found = std::min(slots, count);
+
+    // Ties go to manager order, so equal worlds always list equal asteroids
+    const float* distanceSq = env.distanceSq.data();
+    env.order.resize(count);
+    std::iota(env.order.begin(), env.order.end(), 0u);
+    std::partial_sort(env.order.begin(), env.order.begin() + found, env.order.end(),
+                      [distanceSq](uint32_t a, uint32_t b) {
+                          return distanceSq[a] < distanceSq[b] ||
+                                 (distanceSq[a] == distanceSq[b] && a < b);
+                      });
+
+    const float inverseRange = 1.0f / options.sensorRange;
+    const float inverseSpeed = 1.0f / config->shipMaxSpeed;
+    const float inverseRadius = 1.0f / Asteroid::getRadius(Asteroid::Size::Large);
+    for (size_t slot = 0; slot < found; ++slot) {
+        const uint32_t i = env.order[slot];
+        out[0] = 1.0f;
+        out[1] = env.offsetX[i] * inverseRange;
+        out[2] = env.offsetY[i] * inverseRange;
+        out[3] = env.velocityX[i] * inverseSpeed;
+        out[4] = env.velocityY[i] * inverseSpeed;
+        out[5] = env.radius[i] * inverseRadius;
+        out += ASTEROID_FEATURES;
+    }
+    std::fill(out, out + (slots - found) * ASTEROID_FEATURES, 0.0f);
+}
+
+// Each ray keeps the nearest surface it meets. Asteroids out of reach of
+// every ray are skipped first; the rest are tested against all rays at once.
+// A sensor range beyond half the world sees past the nearest image of an
+// asteroid, so every wrapped copy within reach is tested too.
+void EnvBatch::writeRays(Env& env, const Vec2& heading, float* out) const {
+    const size_t rays = env.rayX.size();
+    if (rays == 0) return;
+
+    // Rotate the fan onto the heading, clockwise on screen
+    float* __restrict rayX = env.rayX.data();
+    float* __restrict rayY = env.rayY.data();
+    for (size_t r = 0; r < rays; ++r) {
+        rayX[r] = heading.x * rayOffsetCos[r] - heading.y * rayOffsetSin[r];
+        rayY[r] = heading.y * rayOffsetCos[r] + heading.x * rayOffsetSin[r];
+    }
+
+    const float range = options.sensorRange;
+    std::fill(out, out + rays, range);
+    float* __restrict nearest = out;
+    auto cast = [&](float cx, float cy, float radius) {
+        const float outside = cx * cx + cy * cy - radius * radius;
+        for (size_t r = 0; r < rays; ++r) {
+            // Ray-circle: nearest t >= 0 with |t * ray - c| = radius
+            const float along = cx * rayX[r] + cy * rayY[r];
+            const float discriminant = along * along - outside;
+            const float t = along - std::sqrt(std::max(discriminant, 0.0f));
+            const float hit = outside <= 0.0f ? 0.0f :
+                              (along > 0.0f && discriminant >= 0.0f) ? t : range;
+            nearest[r] = std::min(nearest[r], hit);
+        }
+    };
+
+    const float width = config->width;
+    const float height = config->height;
+    for (size_t i = 0; i < env.offsetX.size(); ++i) {
+        const float reach = range + env.radius[i];
+        // The nearest image is the closest copy; if it is out of reach, all are
+        if (env.distanceSq[i] >= reach * reach) continue;
+
+        const int copiesX = static_cast<int>(reach / width) + 1;
+        const int copiesY = static_cast<int>(reach / height) + 1;
+        for (int ky = -copiesY; ky <= copiesY; ++ky) {
+            const float cy = env.offsetY[i] + ky * height;
+            if (std::abs(cy) >= reach) continue;
+            for (int kx = -copiesX; kx <= copiesX; ++kx) {
+                const float cx = env.offsetX[i] + kx * width;
+                if (cx * cx + cy * cy >= reach * reach) continue;
+                cast(cx, cy, env.radius[i]);
+            }
+        }
+    }
+
+    const float inverseRange = 1.0f / range;
+    for (size_t r = 0; r < rays; ++r) {
+        out[r] *= inverseRange;
+    }
+}
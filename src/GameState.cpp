@@ -1,21 +1,60 @@
 // src/GameState.cpp
 #include "GameState.hpp"
+#include <algorithm>
 #include <cmath>
+#include <cstring>
 #include <random>
+#include <stdexcept>
+#include <type_traits>
 #include "DebugUtils.hpp"
 #include "Constants.hpp"
+#include "Profiler.hpp"
+#include "Vector2D.hpp"
 
-GameState::GameState() {
-    if (!font.loadFromFile(FONT_PATH)) {
-        // Just continue without font - handled in draw methods
-    }
+GameState::GameState() : GameState(std::make_unique<NullInput>()) {}
+
+GameState::GameState(std::unique_ptr<InputSource> input)
+    : GameState(std::move(input), std::random_device{}()) {}
+
+GameState::GameState(std::unique_ptr<InputSource> input, uint32_t seed)
+    : GameState(std::move(input), seed, std::make_shared<const WorldConfig>()) {}
+
+namespace {
+std::shared_ptr<const WorldConfig> validated(std::shared_ptr<const WorldConfig> config) {
+    if (!config) throw std::invalid_argument("GameState needs a world config");
+    config->validate();
+    return config;
+}
+} // namespace
+
+GameState::GameState(std::unique_ptr<InputSource> input, uint32_t seed,
+                     std::shared_ptr<const WorldConfig> config)
+    : config(validated(std::move(config))), seed(seed), rng(seed), input(std::move(input)) {
+    explosions.reserve(64);
     reset();
 }
 
+void GameState::loadFont() {
+    // Deferred to first use so headless runs never touch the font
+    fontLoadAttempted = true;
+    fontLoaded = font.loadFromFile(FONT_PATH);
+    if (fontLoaded) {
+        renderer.setFont(font);
+    }
+    // Without a font the HUD stays blank
+}
+
+const sf::Font* GameState::getFont() {
+    if (!fontLoadAttempted) {
+        loadFont();
+    }
+    return fontLoaded ? &font : nullptr;
+}
+
 void GameState::reset() {
-    ship.emplace();  // Create new ship
+    ship.emplace(*config);  // Create new ship
     if (ship) {
-        ship->setPosition(sf::Vector2f(WINDOW_WIDTH / 2.0f, WINDOW_HEIGHT / 2.0f));
+        ship->setPosition(config->size() / 2.0f);
     }
     
     asteroidManager.clear();
@@ -24,183 +63,473 @@ void GameState::reset() {
 }
 
 void GameState::createInitialAsteroids() {
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<float> speedDist(ASTEROID_MIN_SPEED, ASTEROID_MAX_SPEED);
-    std::uniform_real_distribution<float> angleDist(0, 2 * M_PI);
-    
-    for (int i = 0; i < INITIAL_ASTEROID_COUNT; ++i) {
+    const int count = config->asteroidCount;
+    const sf::Vector2f centre = config->size() / 2.0f;
+    const float distance = std::min(config->width, config->height) * 0.4f;
+
+    // A ring around the ship while the asteroids fit on it without touching;
+    // crowded worlds scatter them instead, clear of the ship
+    const float ringSpacing = 2.5f * Asteroid::getRadius(Asteroid::Size::Large);
+    const bool ring = count * ringSpacing <= 2.0f * M_PI * distance;
+    const float clearance = std::min(distance, 4.0f * Asteroid::getRadius(Asteroid::Size::Large));
+
+    for (int i = 0; i < count; ++i) {
         // Create a new large asteroid
-        auto asteroid = std::make_unique<Asteroid>(Asteroid::Size::Large);
+        Asteroid* asteroid = asteroidManager.spawn(Asteroid::Size::Large, rng, *config);
         
-        // Calculate spawn position around the edges
-        float angle = (i * 2.0f * M_PI) / INITIAL_ASTEROID_COUNT;
-        float distance = std::min(WINDOW_WIDTH, WINDOW_HEIGHT) * 0.4f;
-        sf::Vector2f spawnPos(
-            (WINDOW_WIDTH / 2.0f) + std::cos(angle) * distance,
-            (WINDOW_HEIGHT / 2.0f) + std::sin(angle) * distance
-        );
+        sf::Vector2f spawnPos;
+        if (ring) {
+            float angle = (i * 2.0f * M_PI) / count;
+            spawnPos = centre + sf::Vector2f(vec2::fromAngle(angle) * distance);
+        } else {
+            do {
+                spawnPos = sf::Vector2f(rng.uniform(0.0f, config->width),
+                                        rng.uniform(0.0f, config->height));
+            } while (std::abs(spawnPos.x - centre.x) < clearance &&
+                     std::abs(spawnPos.y - centre.y) < clearance);
+        }
         asteroid->setPosition(spawnPos);
         
         // Calculate velocity directed somewhat towards center
-        float speedAngle = angleDist(gen);
-        float speed = speedDist(gen);
-        sf::Vector2f velocity(
-            std::cos(speedAngle) * speed,
-            std::sin(speedAngle) * speed
-        );
-        asteroid->setVelocity(velocity);
-        
-        // Add the asteroid to the manager
-        size_t countBefore = asteroidManager.count();
-        asteroidManager.spawn(std::move(asteroid));
-        size_t countAfter = asteroidManager.count();
-        LOG_VALUE("Asteroid count before", countBefore);
-        LOG_VALUE("Asteroid count after", countAfter);
+        float speedAngle = rng.uniform(0.0f, 2.0f * M_PI);
+        float speed = rng.uniform(config->asteroidMinSpeed, config->asteroidMaxSpeed);
+        asteroid->setVelocity(vec2::fromAngle(speedAngle) * speed);
     }
+    LOG_VALUE("Asteroid count", asteroidManager.count());
 }
 
 void GameState::update(float deltaTime) {
+    PROFILE_SCOPE("GameState::update");
+    InputState controls = input ? input->poll() : InputState{};
+
+    ++tick;
+    auto current = std::find_if(explosions.begin(), explosions.end(),
+        [this](const RenderSnapshot::Explosion& e) { return e.tick + explosionHistoryTicks > tick; });
+    explosions.erase(explosions.begin(), current);
+
     if (!ship) {
-        handleGameOver();
+        handleGameOver(controls);
         return;
     }
 
     if (asteroidManager.count() == 0) {
-        handleWin();
+        handleWin(controls);
         reset();
     }
 
+    ship->setInput(controls);
     ship->update(deltaTime);
     asteroidManager.update(deltaTime);
     checkCollisions();
+
+    // Drop everything hit this tick in one pass per manager
+    if (ship) {
+        ship->getBulletManager().compact();
+    }
+    asteroidManager.compact();
 }
 
 void GameState::checkCollisions() {
+    PROFILE_SCOPE("checkCollisions");
     if (!ship) return;
 
-    for (const auto& asteroid : asteroidManager.getObjects()) {
-        if (!asteroid) continue;
-        
-        if (CollisionManager::checkCollision(*ship, *asteroid)) {
-            ship.reset();
-            return;
+    const auto& asteroids = asteroidManager.getObjects();
+    buildAsteroidGrid();
+
+    // Swept tests catch contacts anywhere along this tick's motion, so
+    // large steps can't carry anything through an asteroid
+    bool shipHit = false;
+    float timeOfImpact;
+    querySweep(*ship, ship->getRadius(), [&](uint32_t id) {
+        if (!shipHit && CollisionManager::sweep(*ship, *asteroids[id], timeOfImpact)) {
+            shipHit = true;
+        }
+    });
+    if (shipHit) {
+        addExplosion(*ship, ship->getRadius());
+        ship.reset();
+        return;
+    }
+
+    // Each chunk of bullets finds its contacts independently; only resolving
+    // them, which marks, scores and splits, has to follow bullet order. One
+    // chunk covers the classic magazine, so this splits only in worlds that
+    // fire fast and far, such as bullet-hell.
+    const size_t bulletCount = ship->getBulletManager().getObjects().size();
+    const size_t chunkCount = (bulletCount + BULLETS_PER_CHUNK - 1) / BULLETS_PER_CHUNK;
+    while (hitChunks.size() < chunkCount) {
+        hitChunks.emplace_back();
+        hitChunks.back().hits.reserve(BULLETS_PER_CHUNK);
+    }
+    if (collisionPool && chunkCount > 1) {
+        collisionPool->parallelFor(chunkCount, [this](size_t chunk) { gatherBulletHits(chunk); });
+    } else {
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+            gatherBulletHits(chunk);
         }
     }
-    
-    auto& bullets = ship->getBulletManager().getObjects();
-    for (const auto& bullet : bullets) {
-        if (!bullet) continue;
-        
-        for (const auto& asteroid : asteroidManager.getObjects()) {
-            if (!asteroid) continue;
-            
-            if (CollisionManager::checkCollision(*bullet, *asteroid)) {
-                score += getAsteroidPoints(asteroid->getSize());
-                spawnSmallerAsteroids(*asteroid);
-                
-                LOG("Bullet manager...");
-                ship->getBulletManager().removeIf(
-                    [bullet_ptr = bullet.get()](const Bullet& b) { 
-                        return &b == bullet_ptr; 
-                    });
-
-                LOG("Asteroid manager...");
-                asteroidManager.removeIf(
-                    [asteroid_ptr = asteroid.get()](const Asteroid& a) { 
-                        return &a == asteroid_ptr; 
-                    });
-                
+    resolveBulletHits(chunkCount);
+}
+
+// Record every asteroid each bullet in the chunk swept through this tick.
+// Reads shared state only, so chunks can run on any threads at once.
+void GameState::gatherBulletHits(size_t chunk) {
+    const auto& bullets = ship->getBulletManager().getObjects();
+    const auto& asteroids = asteroidManager.getObjects();
+    std::vector<BulletHit>& hits = hitChunks[chunk].hits;
+    hits.clear();
+
+    const size_t end = std::min(bullets.size(), (chunk + 1) * BULLETS_PER_CHUNK);
+    for (size_t b = chunk * BULLETS_PER_CHUNK; b < end; ++b) {
+        if (!bullets[b]) continue;
+        const Bullet& bullet = *bullets[b];
+
+        const size_t first = hits.size();
+        float timeOfImpact;
+        querySweep(bullet, bullet.getRadius(), [&](uint32_t id) {
+            if (CollisionManager::sweep(bullet, *asteroids[id], timeOfImpact)) {
+                hits.push_back({static_cast<uint32_t>(b), id, timeOfImpact});
+            }
+        });
+        std::sort(hits.begin() + first, hits.end(), [](const BulletHit& lhs, const BulletHit& rhs) {
+            return lhs.timeOfImpact < rhs.timeOfImpact ||
+                   (lhs.timeOfImpact == rhs.timeOfImpact && lhs.asteroid < rhs.asteroid);
+        });
+    }
+}
+
+// Each bullet destroys at most one asteroid: the earliest one it reaches
+// that no earlier bullet destroyed this tick, ties going to manager order
+void GameState::resolveBulletHits(size_t chunkCount) {
+    auto& bulletManager = ship->getBulletManager();
+    const auto& asteroids = asteroidManager.getObjects();
+
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        const std::vector<BulletHit>& hits = hitChunks[chunk].hits;
+        size_t i = 0;
+        while (i < hits.size()) {
+            const uint32_t bullet = hits[i].bullet;
+            size_t next = i;
+            while (next < hits.size() && hits[next].bullet == bullet) ++next;
+
+            for (; i < next; ++i) {
+                const uint32_t id = hits[i].asteroid;
+                if (asteroidManager.isMarkedForRemoval(id)) continue;
+
+                // Marking leaves both containers untouched until compact()
+                const Asteroid& asteroid = *asteroids[id];
+                asteroidManager.markForRemoval(id);
+                bulletManager.markForRemoval(bullet);
+                score += getAsteroidPoints(asteroid.getSize());
+                addExplosion(asteroid, asteroid.getRadius());
+                spawnSmallerAsteroids(asteroid);
                 break;
             }
+            i = next;
         }
     }
 }
 
+void GameState::addExplosion(const GameObject& object, float radius) {
+    explosions.push_back({object.getPosition(), object.getVelocity(), radius, tick});
+}
+
+// Staging chases one pointer per asteroid, so big worlds split it into
+// chunks; the counting sort over the staged cells stays serial
+void GameState::buildAsteroidGrid() {
+    const size_t count = asteroidManager.getObjects().size();
+    const size_t chunkCount = (count + ASTEROIDS_PER_CHUNK - 1) / ASTEROIDS_PER_CHUNK;
+    if (gridChunks.size() < chunkCount) {
+        gridChunks.resize(chunkCount);
+    }
+
+    asteroidGrid.clear();
+    asteroidGrid.resizeStaged(count);
+    if (collisionPool && chunkCount > 1) {
+        collisionPool->parallelFor(chunkCount, [this](size_t chunk) { stageAsteroids(chunk); });
+    } else {
+        for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+            stageAsteroids(chunk);
+        }
+    }
+
+    // Maxima don't depend on the order they are combined in
+    float longestStepSquared = 0.0f;
+    for (size_t chunk = 0; chunk < chunkCount; ++chunk) {
+        asteroidGrid.growMaxRadius(gridChunks[chunk].maxRadius);
+        longestStepSquared = std::max(longestStepSquared, gridChunks[chunk].longestStepSquared);
+    }
+    asteroidGrid.build();
+    asteroidStepReach = std::sqrt(longestStepSquared);
+}
+
+// Stage one chunk of asteroids in their own grid slots. Writes only the
+// chunk's slots and its GridChunk, so chunks can run on any threads at once.
+void GameState::stageAsteroids(size_t chunk) {
+    const auto& asteroids = asteroidManager.getObjects();
+    GridChunk& result = gridChunks[chunk];
+    result = GridChunk{0.0f, 0.0f};
+
+    const size_t end = std::min(asteroids.size(), (chunk + 1) * ASTEROIDS_PER_CHUNK);
+    for (size_t i = chunk * ASTEROIDS_PER_CHUNK; i < end; ++i) {
+        if (!asteroids[i]) continue;
+        asteroidGrid.stageAt(i, static_cast<uint32_t>(i), asteroids[i]->getPosition());
+        result.maxRadius = std::max(result.maxRadius, asteroids[i]->getRadius());
+
+        sf::Vector2f step = CollisionManager::displacement(*asteroids[i]);
+        result.longestStepSquared = std::max(result.longestStepSquared, vec2::lengthSq(step));
+    }
+}
+
+// Visit every asteroid that may have touched the object's path this tick:
+// query around the middle of the path, reaching over both ends of it and
+// back along the longest asteroid step
+template<typename Fn>
+void GameState::querySweep(const GameObject& object, float radius, Fn&& fn) const {
+    sf::Vector2f halfStep = CollisionManager::displacement(object) * 0.5f;
+    float halfLength = vec2::length(halfStep);
+    asteroidGrid.query(object.getPreviousPosition() + halfStep,
+                       radius + halfLength + asteroidStepReach, std::forward<Fn>(fn));
+}
+
 void GameState::spawnSmallerAsteroids(const Asteroid& original) {
     if (original.getSize() == Asteroid::Size::Small) return;
     
     Asteroid::Size newSize = (original.getSize() == Asteroid::Size::Large) ? 
         Asteroid::Size::Medium : Asteroid::Size::Small;
     
-    std::random_device rd;
-    std::mt19937 gen(rd());
-    std::uniform_real_distribution<float> angleDist(-M_PI/3, M_PI/3);
+    const float maxSpread = M_PI / 3;
     
     sf::Vector2f origVel = original.getVelocity();
-    float speed = std::sqrt(origVel.x * origVel.x + origVel.y * origVel.y) * 1.5f;
+    float speed = vec2::length(origVel) * 1.5f;
     float baseAngle = std::atan2(origVel.y, origVel.x);
     
-    for (int i = 0; i < 2; ++i) {
-        auto newAsteroid = std::make_unique<Asteroid>(newSize);
+    for (int i = 0; i < config->splitFanOut; ++i) {
+        Asteroid* newAsteroid = asteroidManager.spawn(newSize, rng, *config);
         newAsteroid->setPosition(original.getPosition());
         
-        float spreadAngle = (i == 0) ? angleDist(gen) : -angleDist(gen);
+        // Alternate sides of the parent's heading
+        float spreadAngle = rng.uniform(-maxSpread, maxSpread);
+        if (i % 2 == 1) spreadAngle = -spreadAngle;
         float finalAngle = baseAngle + spreadAngle;
         
-        newAsteroid->setVelocity(sf::Vector2f(
-            std::cos(finalAngle) * speed,
-            std::sin(finalAngle) * speed
-        ));
-        
-        asteroidManager.spawn(std::move(newAsteroid));
+        newAsteroid->setVelocity(vec2::fromAngle(finalAngle) * speed);
     }
 }
 
-void GameState::draw(sf::RenderWindow& window) {
+namespace {
+
+constexpr char SNAPSHOT_MAGIC[4] = {'A', 'S', 'N', 'P'};
+constexpr uint32_t SNAPSHOT_VERSION = 3;  // 2: asteroids store a shape index
+                                          // 3: ship stores its fire cooldown
+
+// Followed by the bullet states, then the asteroid states. Within each
+// manager, active objects come before ones still pending.
+struct SnapshotHeader {
+    char magic[4];
+    uint32_t version;
+    uint32_t seed;
+    int32_t score;
+    Random::State rng;
+    uint32_t activeBullets;
+    uint32_t pendingBullets;
+    uint32_t activeAsteroids;
+    uint32_t pendingAsteroids;
+    uint32_t hasShip;
+    Ship::State ship;
+};
+
+static_assert(std::is_trivially_copyable_v<SnapshotHeader>);
+static_assert(std::is_trivially_copyable_v<Bullet::State>);
+static_assert(std::is_trivially_copyable_v<Asteroid::State>);
+
+// No padding anywhere, so equal worlds give byte-identical snapshots
+static_assert(sizeof(Ship::State) == sizeof(GameObject::Body) + 16);
+static_assert(sizeof(Bullet::State) == sizeof(GameObject::Body) + 8);
+static_assert(sizeof(Asteroid::State) == sizeof(GameObject::Body) + 20);
+static_assert(sizeof(SnapshotHeader) == 52 + sizeof(Ship::State));
+
+template<typename T>
+uint8_t* writeStates(uint8_t* out, const typename GameObjectManager<T>::Container& objects) {
+    for (const auto& obj : objects) {
+        typename T::State state = obj->getState();
+        std::memcpy(out, &state, sizeof(state));
+        out += sizeof(state);
+    }
+    return out;
+}
+
+// Calls add(state) for each of count states stored at in
+template<typename T, typename Add>
+const uint8_t* readStates(const uint8_t* in, uint32_t count, Add add) {
+    for (uint32_t i = 0; i < count; ++i) {
+        typename T::State state;
+        std::memcpy(&state, in, sizeof(state));
+        in += sizeof(state);
+        add(state);
+    }
+    return in;
+}
+
+// Size indexes the radius and point tables and shapeIndex the shape cache,
+// so both must be in range before any asteroid is built from the record
+bool validAsteroidStates(const uint8_t* in, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        Asteroid::State state;
+        std::memcpy(&state, in + i * sizeof(state), sizeof(state));
+        using Raw = std::underlying_type_t<Asteroid::Size>;
+        const Raw size = static_cast<Raw>(state.size);
+        if (size < static_cast<Raw>(Asteroid::Size::Small) ||
+            size > static_cast<Raw>(Asteroid::Size::Large) ||
+            state.shapeIndex >= Asteroid::SHAPES_PER_SIZE) {
+            return false;
+        }
+    }
+    return true;
+}
+
+} // namespace
+
+void GameState::saveSnapshot(std::vector<uint8_t>& out) const {
+    static const GameObjectManager<Bullet> noBullets;
+    const GameObjectManager<Bullet>& bullets = ship ? ship->getBulletManager() : noBullets;
+
+    SnapshotHeader header{};
+    std::memcpy(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC));
+    header.version = SNAPSHOT_VERSION;
+    header.seed = seed;
+    header.score = score;
+    header.rng = rng.getState();
+    header.activeBullets = static_cast<uint32_t>(bullets.getObjects().size());
+    header.pendingBullets = static_cast<uint32_t>(bullets.getPending().size());
+    header.activeAsteroids = static_cast<uint32_t>(asteroidManager.getObjects().size());
+    header.pendingAsteroids = static_cast<uint32_t>(asteroidManager.getPending().size());
+    header.hasShip = ship.has_value();
     if (ship) {
-        ship->draw(window);
+        header.ship = ship->getState();
     }
-    asteroidManager.draw(window);
-    
-    // Draw score if font loaded
-    if (!font.getInfo().family.empty()) {
-        sf::Text scoreText;
-        scoreText.setFont(font);
-        scoreText.setCharacterSize(20);
-        scoreText.setFillColor(sf::Color::White);
-        scoreText.setString("Score: " + std::to_string(score));
-        scoreText.setPosition(10.f, 10.f);
-        window.draw(scoreText);
+
+    out.resize(sizeof(header) +
+               (header.activeBullets + header.pendingBullets) * sizeof(Bullet::State) +
+               (header.activeAsteroids + header.pendingAsteroids) * sizeof(Asteroid::State));
+
+    uint8_t* cursor = out.data();
+    std::memcpy(cursor, &header, sizeof(header));
+    cursor += sizeof(header);
+    cursor = writeStates<Bullet>(cursor, bullets.getObjects());
+    cursor = writeStates<Bullet>(cursor, bullets.getPending());
+    cursor = writeStates<Asteroid>(cursor, asteroidManager.getObjects());
+    writeStates<Asteroid>(cursor, asteroidManager.getPending());
+}
+
+void GameState::restoreSnapshot(const std::vector<uint8_t>& data) {
+    SnapshotHeader header;
+    if (data.size() < sizeof(header)) {
+        throw std::runtime_error("Snapshot too short");
     }
-    
-    if (isGameOver() && !font.getInfo().family.empty()) {
-        sf::Text gameOverText;
-   gameOverText.setFont(font);
-        gameOverText.setCharacterSize(32);
-        gameOverText.setFillColor(sf::Color::White);
-        gameOverText.setString("Game Over!\nPress R to restart");
-        
-        sf::FloatRect bounds = gameOverText.getLocalBounds();
-        gameOverText.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
-        gameOverText.setPosition(WINDOW_WIDTH / 2.f, WINDOW_HEIGHT / 2.f);
-        
-        window.draw(gameOverText);
+    std::memcpy(&header, data.data(), sizeof(header));
+    if (std::memcmp(header.magic, SNAPSHOT_MAGIC, sizeof(SNAPSHOT_MAGIC)) != 0 ||
+        header.version != SNAPSHOT_VERSION) {
+        throw std::runtime_error("Not a version " + std::to_string(SNAPSHOT_VERSION) + " snapshot");
+    }
+    size_t expected = sizeof(header) +
+        (size_t(header.activeBullets) + header.pendingBullets) * sizeof(Bullet::State) +
+        (size_t(header.activeAsteroids) + header.pendingAsteroids) * sizeof(Asteroid::State);
+    if (data.size() != expected || (!header.hasShip && header.activeBullets + header.pendingBullets)) {
+        throw std::runtime_error("Corrupt snapshot");
     }
+    const uint8_t* asteroidStates = data.data() + sizeof(header) +
+        (size_t(header.activeBullets) + header.pendingBullets) * sizeof(Bullet::State);
+    if (!validAsteroidStates(asteroidStates, size_t(header.activeAsteroids) + header.pendingAsteroids)) {
+        throw std::runtime_error("Corrupt snapshot");
+    }
+
+    seed = header.seed;
+    score = header.score;
+    explosions.clear();
+    rng.setState(header.rng);
 
-    if (isGameWon() && !font.getInfo().family.empty()) {
-        sf::Text winText;
-        winText.setFont(font);
-        winText.setCharacterSize(32);
-        winText.setFillColor(sf::Color::White);
-        winText.setString("You win!\nPress R to restart");
+    const uint8_t* cursor = data.data() + sizeof(header);
+    if (header.hasShip) {
+        if (!ship) ship.emplace(*config);
+        ship->setState(header.ship);
 
-        sf::FloatRect bounds = winText.getLocalBounds();
-        winText.setOrigin(bounds.width / 2.f, bounds.height / 2.f);
-        winText.setPosition(WINDOW_WIDTH / 2.f, WINDOW_HEIGHT / 2.f);
+        auto& bullets = ship->getBulletManager();
+        bullets.clear();
+        cursor = readStates<Bullet>(cursor, header.activeBullets,
+                                    [&](const Bullet::State& s) { bullets.spawnActive(s, *config); });
+        cursor = readStates<Bullet>(cursor, header.pendingBullets,
+                                    [&](const Bullet::State& s) { bullets.spawn(s, *config); });
+    } else {
+        ship.reset();
+    }
 
-        window.draw(winText);
+    asteroidManager.clear();
+    cursor = readStates<Asteroid>(cursor, header.activeAsteroids,
+                                  [&](const Asteroid::State& s) {
+                                      asteroidManager.spawnActive(s, *config);
+                                  });
+    readStates<Asteroid>(cursor, header.pendingAsteroids,
+                         [&](const Asteroid::State& s) { asteroidManager.spawn(s, *config); });
+}
+
+void GameState::draw(sf::RenderTarget& target, float alpha) {
+    PROFILE_SCOPE("GameState::draw");
+    if (!fontLoadAttempted) {
+        loadFont();
+    }
+
+    // Same path as a render thread drawing published snapshots
+    captureRenderSnapshot(frame);
+    renderer.draw(target, frame, alpha);
+}
+
+void GameState::draw(RenderCommandList& out, float alpha) {
+    captureRenderSnapshot(frame);
+    renderer.record(frame, alpha, out);
+}
+
+void GameState::captureRenderSnapshot(RenderSnapshot& out) const {
+    out.clear();
+    out.worldSize = config->size();
+    out.tick = tick;
+    out.tickStep = config->tickStep();
+    out.explosions.insert(out.explosions.end(), explosions.begin(), explosions.end());
+    out.score = score;
+    out.phase = isGameOver() ? Hud::Phase::GameOver :
+                isGameWon() ? Hud::Phase::Won : Hud::Phase::Playing;
+
+    if (ship) {
+        Ship::State state = ship->getState();
+        out.hasShip = true;
+        out.thrusting = state.thrusting;
+        out.ship = {state.body.previousPosition, state.body.position,
+                    state.previousRotation, state.rotation};
+
+        for (const auto& bullet : ship->getBulletManager().getObjects()) {
+            if (!bullet) continue;
+            const GameObject::Body body = bullet->getBody();
+            out.bullets.push_back({body.previousPosition, body.position, 0.0f, 0.0f});
+        }
+    }
+
+    for (const auto& asteroid : asteroidManager.getObjects()) {
+        if (!asteroid) continue;
+        Asteroid::State state = asteroid->getState();
+        out.asteroids.push_back({{state.body.previousPosition, state.body.position,
+                                  state.previousRotation, state.rotation},
+                                 state.size, state.shapeIndex});
     }
 }
 
-void GameState::handleGameOver() {
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::R)) {
+void GameState::handleGameOver(const InputState& controls) {
+    if (controls.restart) {
         reset();
     }
 }
 
-void GameState::handleWin() {
-    if (sf::Keyboard::isKeyPressed(sf::Keyboard::R)) {
+void GameState::handleWin(const InputState& controls) {
+    if (controls.restart) {
         reset();
     }
 }
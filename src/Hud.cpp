@@ -0,0 +1,46 @@
+// src/Hud.cpp
+#include "Hud.hpp"
+#include <cstdio>
+#include "Constants.hpp"
+
+namespace {
+constexpr unsigned SCORE_TEXT_SIZE = 20;
+constexpr unsigned BANNER_TEXT_SIZE = 32;
+} // namespace
+
+void Hud::update(int score, Phase phase) {
+    frameRebuilds = 0;
+
+    if (dirty || score != shownScore) {
+        rebuildScore(score);
+    }
+    if ((dirty || phase != shownPhase) && phase != Phase::Playing) {
+        rebuildBanner(phase);
+    }
+    shownPhase = phase;
+    dirty = false;
+}
+
+void Hud::rebuildScore(int score) {
+    std::snprintf(scoreText, sizeof(scoreText), "Score: %d", score);
+    shownScore = score;
+    ++frameRebuilds;
+    ++totalRebuilds;
+}
+
+void Hud::rebuildBanner(Phase phase) {
+    bannerText = phase == Phase::GameOver ? "Game Over!\nPress R to restart"
+                                          : "You win!\nPress R to restart";
+    ++frameRebuilds;
+    ++totalRebuilds;
+}
+
+void Hud::draw(RenderCommandList& commands) const {
+    if (dirty) return;
+
+    commands.addText(scoreText, sf::Vector2f(10.f, 10.f), SCORE_TEXT_SIZE, sf::Color::White);
+    if (shownPhase != Phase::Playing) {
+        commands.addText(bannerText, sf::Vector2f(WINDOW_WIDTH / 2.f, WINDOW_HEIGHT / 2.f),
+                         BANNER_TEXT_SIZE, sf::Color::White, true);
+    }
+}
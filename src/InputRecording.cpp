@@ -0,0 +1,227 @@
+// src/InputRecording.cpp
+#include "InputRecording.hpp"
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+#include "WorldConfig.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ASTEROIDS_HAVE_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+using namespace recording;
+
+namespace {
+size_t keyframeOffset(uint64_t runCount) {
+    size_t end = sizeof(Header) + runCount * sizeof(uint32_t);
+    return (end + 7) & ~size_t(7);
+}
+} // namespace
+
+// --- InputRecorder ---
+
+InputRecorder::InputRecorder(const std::string& path, uint32_t seed, float stepSeconds,
+                             const WorldConfig& world)
+    : file(path, std::ios::binary | std::ios::trunc), seed(seed), stepSeconds(stepSeconds),
+      configHash(world.hash()) {
+    if (!file) {
+        throw std::runtime_error("Cannot write recording: " + path);
+    }
+    // Placeholder, rewritten by finish()
+    Header header{};
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+}
+
+InputRecorder::~InputRecorder() {
+    try {
+        finish();
+    } catch (...) {
+        // Nothing useful to do with a failed write during teardown
+    }
+}
+
+void InputRecorder::record(const InputState& state) {
+    uint32_t bits = packInput(state);
+    if (runLength == 0 || bits != runBits || runLength == MAX_RUN_LENGTH) {
+        closeRun();
+        runBits = bits;
+        runStartTick = tickCount;
+    }
+    ++runLength;
+
+    if (tickCount % KEYFRAME_INTERVAL == 0) {
+        keyframes.push_back({runCount, runStartTick});
+    }
+    ++tickCount;
+}
+
+void InputRecorder::closeRun() {
+    if (runLength == 0) return;
+    uint32_t packed = runBits | ((runLength - 1) << BUTTON_BITS);
+    file.write(reinterpret_cast<const char*>(&packed), sizeof(packed));
+    ++runCount;
+    runLength = 0;
+}
+
+void InputRecorder::finish() {
+    if (finished) return;
+    finished = true;
+    closeRun();
+
+    static const char zeros[8] = {};
+    size_t runsEnd = sizeof(Header) + runCount * sizeof(uint32_t);
+    file.write(zeros, keyframeOffset(runCount) - runsEnd);
+    file.write(reinterpret_cast<const char*>(keyframes.data()),
+               keyframes.size() * sizeof(Keyframe));
+
+    Header header{};
+    std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+    header.version = VERSION;
+    header.seed = seed;
+    header.stepSeconds = stepSeconds;
+    header.tickCount = tickCount;
+    header.runCount = runCount;
+    header.keyframeCount = keyframes.size();
+    header.keyframeInterval = KEYFRAME_INTERVAL;
+    header.configHash = configHash;
+    file.seekp(0);
+    file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+    file.close();
+
+    if (file.fail()) {
+        throw std::runtime_error("Failed to finish recording");
+    }
+}
+
+// --- InputRecording ---
+
+InputRecording::InputRecording(const std::string& path) {
+    load(path);
+    // The destructor won't run if validation throws
+    try {
+        validate(path);
+    } catch (...) {
+        unmap();
+        throw;
+    }
+}
+
+InputRecording::~InputRecording() {
+    unmap();
+}
+
+void InputRecording::unmap() {
+#ifdef ASTEROIDS_HAVE_MMAP
+    if (mapped) {
+        munmap(const_cast<uint8_t*>(data), size);
+        mapped = false;
+    }
+#endif
+}
+
+// Everything locate() and ReplayInput::poll() rely on, so a corrupt or
+// hostile file can't send them past the end of the runs
+void InputRecording::validate(const std::string& path) {
+    if (size < sizeof(Header)) {
+        throw std::runtime_error("Recording too short: " + path);
+    }
+    std::memcpy(&header, data, sizeof(Header));
+    if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION) {
+        throw std::runtime_error("Not a version " + std::to_string(VERSION) + " recording: " + path);
+    }
+
+    const std::runtime_error corrupt("Truncated or corrupt recording: " + path);
+    // Counts are bounded by the file size before any offset is computed from them
+    if (header.runCount > (size - sizeof(Header)) / sizeof(uint32_t)) throw corrupt;
+    const size_t keyframesAt = keyframeOffset(header.runCount);
+    if (keyframesAt > size || header.keyframeCount > (size - keyframesAt) / sizeof(Keyframe) ||
+        header.keyframeInterval == 0) {
+        throw corrupt;
+    }
+    const uint64_t expectedKeyframes = header.tickCount / header.keyframeInterval +
+                                       (header.tickCount % header.keyframeInterval != 0);
+    if (header.keyframeCount != expectedKeyframes) throw corrupt;
+
+    runs = reinterpret_cast<const uint32_t*>(data + sizeof(Header));
+    keyframes = reinterpret_cast<const Keyframe*>(data + keyframesAt);
+
+    // One pass over the runs: they must cover tickCount exactly, and every
+    // keyframe must name the run its tick falls in
+    uint64_t runStart = 0;
+    uint64_t keyframe = 0;
+    for (uint64_t i = 0; i < header.runCount; ++i) {
+        const uint64_t runEnd = runStart + runLength(i);
+        for (; keyframe < header.keyframeCount &&
+               keyframe * header.keyframeInterval < runEnd; ++keyframe) {
+            if (keyframes[keyframe].runIndex != i || keyframes[keyframe].runStartTick != runStart) {
+                throw corrupt;
+            }
+        }
+        runStart = runEnd;
+    }
+    if (runStart != header.tickCount || keyframe != header.keyframeCount) throw corrupt;
+}
+
+void InputRecording::load(const std::string& path) {
+#ifdef ASTEROIDS_HAVE_MMAP
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd >= 0) {
+        struct stat info;
+        if (fstat(fd, &info) == 0 && info.st_size > 0) {
+            void* address = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ,
+                                 MAP_PRIVATE, fd, 0);
+            if (address != MAP_FAILED) {
+                data = static_cast<const uint8_t*>(address);
+                size = static_cast<size_t>(info.st_size);
+                mapped = true;
+            }
+        }
+        ::close(fd);
+        if (mapped) return;
+    }
+#endif
+    std::ifstream file(path, std::ios::binary | std::ios::ate);
+    if (!file) {
+        throw std::runtime_error("Cannot open recording: " + path);
+    }
+    fallback.resize(static_cast<size_t>(file.tellg()));
+    file.seekg(0);
+    file.read(reinterpret_cast<char*>(fallback.data()), fallback.size());
+    data = fallback.data();
+    size = fallback.size();
+}
+
+Keyframe InputRecording::locate(uint64_t tick) const {
+    Keyframe position = keyframes[tick / header.keyframeInterval];
+    while (position.runStartTick + runLength(position.runIndex) <= tick) {
+        position.runStartTick += runLength(position.runIndex);
+        ++position.runIndex;
+    }
+    return position;
+}
+
+bool InputRecording::recordedWith(const WorldConfig& world) const {
+    return header.configHash == world.hash();
+}
+
+InputState InputRecording::inputAt(uint64_t tick) const {
+    if (tick >= header.tickCount) return InputState{};
+    return unpackInput(runBits(locate(tick).runIndex));
+}
+
+// --- ReplayInput ---
+
+InputState ReplayInput::poll() {
+    if (finished()) return InputState{};
+
+    while (runStartTick + recording->runLength(runIndex) <= tick) {
+        runStartTick += recording->runLength(runIndex);
+        ++runIndex;
+    }
+    ++tick;
+    return unpackInput(recording->runBits(runIndex));
+}
@@ -0,0 +1,104 @@
+// src/ParticleSystem.cpp
+#include "ParticleSystem.hpp"
+#include <algorithm>
+#include "Vector2D.hpp"
+
+void ParticleSystem::setCapacity(size_t capacity) {
+    size_t rounded = capacity == 0 ? 0 : 1;
+    while (rounded < capacity) rounded <<= 1;
+
+    positionX.assign(rounded, 0.0f);
+    positionY.assign(rounded, 0.0f);
+    velocityX.assign(rounded, 0.0f);
+    velocityY.assign(rounded, 0.0f);
+    life.assign(rounded, 0.0f);
+    inverseLifetime.assign(rounded, 0.0f);
+    color.assign(rounded, sf::Color::Transparent);
+    mask = rounded == 0 ? 0 : rounded - 1;
+    clear();
+}
+
+void ParticleSystem::emit(const sf::Vector2f& position, const sf::Vector2f& velocity,
+                          float lifetime, const sf::Color& particleColor) {
+    if (capacity() == 0 || lifetime <= 0.0f) return;
+    if (size() == capacity()) {
+        ++tail;  // Overwrite the oldest
+    }
+    const size_t i = static_cast<size_t>(head++) & mask;
+    positionX[i] = position.x;
+    positionY[i] = position.y;
+    velocityX[i] = velocity.x;
+    velocityY[i] = velocity.y;
+    life[i] = lifetime;
+    inverseLifetime[i] = 1.0f / lifetime;
+    color[i] = particleColor;
+}
+
+// The live span is at most two contiguous runs of slots: to the end of the
+// arrays, then from the start after wrapping
+void ParticleSystem::update(float deltaTime) {
+    if (empty()) return;
+
+    // Per-step factor of the exponential decay, linearised like the integration
+    const float damping = std::max(0.0f, 1.0f - drag * deltaTime);
+    const size_t first = static_cast<size_t>(tail) & mask;
+    const size_t end = first + size();
+    integrate(first, std::min(end, capacity()), deltaTime, damping);
+    if (end > capacity()) {
+        integrate(0, end - capacity(), deltaTime, damping);
+    }
+
+    while (tail != head && life[static_cast<size_t>(tail) & mask] <= 0.0f) {
+        ++tail;
+    }
+}
+
+// Branch-free loops over restrict-qualified arrays, one per quantity, so
+// each vectorises on its own; positions advance with the damped velocities
+// through the shared SIMD kernel
+void ParticleSystem::integrate(size_t first, size_t last, float deltaTime, float damping) {
+    float* __restrict vx = velocityX.data();
+    float* __restrict vy = velocityY.data();
+    for (size_t i = first; i < last; ++i) {
+        vx[i] *= damping;
+    }
+    for (size_t i = first; i < last; ++i) {
+        vy[i] *= damping;
+    }
+    vec2::integrate(positionX.data() + first, positionY.data() + first, vx + first, vy + first,
+                    last - first, deltaTime);
+
+    float* __restrict remaining = life.data();
+    for (size_t i = first; i < last; ++i) {
+        remaining[i] -= deltaTime;
+    }
+}
+
+void ParticleSystem::draw(RenderCommandList& commands) const {
+    if (empty()) return;
+
+    sf::Vertex* out = commands.addLines(2 * size());
+    const size_t first = static_cast<size_t>(tail) & mask;
+    const size_t end = first + size();
+    const size_t split = std::min(end, capacity());
+    writeStreaks(first, split, out);
+    if (end > capacity()) {
+        writeStreaks(0, end - capacity(), out + 2 * (split - first));
+    }
+}
+
+// Bright at the particle, transparent at the streak's far end
+void ParticleSystem::writeStreaks(size_t first, size_t last, sf::Vertex* out) const {
+    for (size_t i = first; i < last; ++i) {
+        const float fade = std::clamp(life[i] * inverseLifetime[i], 0.0f, 1.0f);
+        sf::Color head = color[i];
+        head.a = static_cast<sf::Uint8>(head.a * fade);
+        sf::Color trail = head;
+        trail.a = 0;
+
+        const sf::Vector2f position(positionX[i], positionY[i]);
+        const sf::Vector2f velocity(velocityX[i], velocityY[i]);
+        *out++ = sf::Vertex(position, head);
+        *out++ = sf::Vertex(position - velocity * STREAK_SECONDS, trail);
+    }
+}
@@ -0,0 +1,165 @@
+// src/Profiler.cpp
+#include "Profiler.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+// --- LatencyHistogram ---
+
+int LatencyHistogram::bucketFor(uint64_t value) {
+    if (value < SUB_BUCKETS) return static_cast<int>(value);
+
+    int exponent = 63;
+    while (!(value >> exponent)) --exponent;
+    int shift = exponent - SUB_BITS;
+    int mantissa = static_cast<int>((value >> shift) & (SUB_BUCKETS - 1));
+    return (shift + 1) * SUB_BUCKETS + mantissa;
+}
+
+uint64_t LatencyHistogram::bucketUpperEdge(int bucket) {
+    if (bucket < SUB_BUCKETS) return static_cast<uint64_t>(bucket);
+
+    int shift = bucket / SUB_BUCKETS - 1;
+    uint64_t mantissa = static_cast<uint64_t>(bucket % SUB_BUCKETS);
+    uint64_t lower = (SUB_BUCKETS + mantissa) << shift;
+    return lower + ((uint64_t(1) << shift) - 1);
+}
+
+void LatencyHistogram::add(uint64_t nanoseconds) {
+    ++counts[bucketFor(nanoseconds)];
+    ++total;
+    sum += nanoseconds;
+    largest = std::max(largest, nanoseconds);
+}
+
+void LatencyHistogram::clear() {
+    counts.fill(0);
+    total = 0;
+    sum = 0;
+    largest = 0;
+}
+
+uint64_t LatencyHistogram::percentile(double fraction) const {
+    if (total == 0) return 0;
+
+    fraction = std::min(std::max(fraction, 0.0), 1.0);
+    uint64_t rank = std::max<uint64_t>(1, static_cast<uint64_t>(std::ceil(fraction * total)));
+    uint64_t seen = 0;
+    for (int bucket = 0; bucket < BUCKETS; ++bucket) {
+        seen += counts[bucket];
+        if (seen >= rank) {
+            return std::min(bucketUpperEdge(bucket), largest);
+        }
+    }
+    return largest;
+}
+
+// --- Profiler ---
+
+int Profiler::registerPhase(const char* name) {
+    std::lock_guard<std::mutex> lock(registerMutex);
+    const size_t count = phaseCount.load(std::memory_order_relaxed);
+    for (size_t i = 0; i < count; ++i) {
+        if (std::strcmp(phases[i].name, name) == 0) return static_cast<int>(i);
+    }
+    if (count == MAX_PHASES) return -1;
+
+    phases[count].name = name;
+    phaseCount.store(count + 1, std::memory_order_release);
+    return static_cast<int>(count);
+}
+
+void Profiler::record(int phase, uint64_t startNs, uint64_t endNs) {
+    if (phase < 0 || static_cast<size_t>(phase) >= phaseCount.load(std::memory_order_acquire)) {
+        return;
+    }
+
+    uint64_t duration = endNs - startNs;
+    std::lock_guard<std::mutex> lock(recordMutex);
+    phases[phase].histogram.add(duration);
+
+    if (capturing) {
+        events.push_back({startNs, static_cast<uint32_t>(std::min<uint64_t>(duration, UINT32_MAX)),
+                          static_cast<uint16_t>(phase),
+                          static_cast<uint8_t>(std::min<uint16_t>(depth, UINT8_MAX)), threadId});
+        if (events.size() == MAX_TRACE_EVENTS) {
+            capturing = false;
+        }
+    }
+}
+
+void Profiler::resetStats() {
+    const size_t count = phaseCount.load(std::memory_order_acquire);
+    std::lock_guard<std::mutex> lock(recordMutex);
+    for (size_t i = 0; i < count; ++i) {
+        phases[i].histogram.clear();
+    }
+}
+
+std::vector<Profiler::PhaseStats> Profiler::stats() const {
+    const size_t count = phaseCount.load(std::memory_order_acquire);
+    std::vector<PhaseStats> result;
+    result.reserve(count);
+    std::lock_guard<std::mutex> lock(recordMutex);
+    for (size_t i = 0; i < count; ++i) {
+        const LatencyHistogram& h = phases[i].histogram;
+        result.push_back({phases[i].name, h.count(), h.mean() / 1000.0,
+                          h.percentile(0.50) / 1000.0, h.percentile(0.99) / 1000.0,
+                          h.max() / 1000.0});
+    }
+    return result;
+}
+
+void Profiler::startCapture() {
+    // Reserve up front so capturing never reallocates mid-frame
+    std::lock_guard<std::mutex> lock(recordMutex);
+    events.clear();
+    events.reserve(MAX_TRACE_EVENTS);
+    capturing = true;
+}
+
+void Profiler::stopCapture() {
+    std::lock_guard<std::mutex> lock(recordMutex);
+    capturing = false;
+}
+
+bool Profiler::isCapturing() const {
+    std::lock_guard<std::mutex> lock(recordMutex);
+    return capturing;
+}
+
+size_t Profiler::capturedEvents() const {
+    std::lock_guard<std::mutex> lock(recordMutex);
+    return events.size();
+}
+
+bool Profiler::writeChromeTrace(const std::string& path) const {
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) return false;
+
+    std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[\n", file);
+    for (size_t i = 0; i < events.size(); ++i) {
+        const TraceEvent& e = events[i];
+        std::fprintf(file,
+                     "%s{\"name\":\"%s\",\"cat\":\"frame\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,"
+                     "\"pid\":1,\"tid\":%u}",
+                     i ? ",\n" : "", phases[e.phase].name, e.startNs / 1000.0,
+                     e.durationNs / 1000.0, static_cast<unsigned>(e.thread));
+    }
+    std::fputs("\n]}\n", file);
+    return std::fclose(file) == 0;
+}
+
+bool Profiler::writeCsv(const std::string& path) const {
+    std::FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) return false;
+
+    std::fputs("phase,start_us,duration_us,depth,thread\n", file);
+    for (const TraceEvent& e : events) {
+        std::fprintf(file, "%s,%.3f,%.3f,%u,%u\n", phases[e.phase].name, e.startNs / 1000.0,
+                     e.durationNs / 1000.0, static_cast<unsigned>(e.depth),
+                     static_cast<unsigned>(e.thread));
+    }
+    return std::fclose(file) == 0;
+}
@@ -0,0 +1,124 @@
+// src/RenderCommandList.cpp
+#include "RenderCommandList.hpp"
+#include <cmath>
+#include <cstring>
+#include <type_traits>
+#include "Constants.hpp"
+#include "Vector2D.hpp"
+
+static_assert(sizeof(RenderCommandList::Command) == 28, "Command must not contain padding");
+static_assert(std::is_trivially_copyable<RenderCommandList::Command>::value,
+              "Commands are hashed as raw bytes");
+static_assert(sizeof(sf::Vertex) == 20 && std::is_trivially_copyable<sf::Vertex>::value,
+              "Vertices are hashed as raw bytes");
+
+namespace {
+
+// Rotation and translation computed once per object
+struct Placement {
+    Placement(const sf::Vector2f& position, float rotation) : position(position) {
+        vec2::SinCos sc = vec2::sinCos(vec2::toRadians(rotation));
+        c = sc.cos;
+        s = sc.sin;
+    }
+
+    sf::Vector2f apply(const sf::Vector2f& p) const {
+        return sf::Vector2f(position.x + p.x * c - p.y * s, position.y + p.x * s + p.y * c);
+    }
+
+    sf::Vector2f position;
+    float c;
+    float s;
+};
+
+constexpr uint64_t FNV_OFFSET = 0xcbf29ce484222325ull;
+constexpr uint64_t FNV_PRIME = 0x100000001b3ull;
+
+// FNV-1a taking eight bytes per step, then the tail a byte at a time
+uint64_t fnv1a(uint64_t hash, const void* data, size_t size) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    size_t i = 0;
+    for (; i + sizeof(uint64_t) <= size; i += sizeof(uint64_t)) {
+        uint64_t word;
+        std::memcpy(&word, bytes + i, sizeof(word));
+        hash = (hash ^ word) * FNV_PRIME;
+    }
+    for (; i < size; ++i) {
+        hash = (hash ^ bytes[i]) * FNV_PRIME;
+    }
+    return hash;
+}
+
+} // namespace
+
+RenderCommandList::Command& RenderCommandList::push(Kind kind, const sf::Color& color,
+                                                    uint32_t first, uint32_t count) {
+    commandBuffer.push_back(Command{kind, 0, 0, 0, color, first, count, sf::Vector2f(), 0.0f});
+    return commandBuffer.back();
+}
+
+void RenderCommandList::addOutline(const sf::Vector2f* points, size_t count,
+                                   const sf::Vector2f& position, float rotation,
+                                   const sf::Color& color) {
+    if (count < 2) return;
+
+    Placement placement(position, rotation);
+    uint32_t first = static_cast<uint32_t>(pointBuffer.size());
+    for (size_t i = 0; i < count; ++i) {
+        pointBuffer.push_back(placement.apply(points[i]));
+    }
+    push(Kind::LineLoop, color, first, static_cast<uint32_t>(count));
+}
+
+void RenderCommandList::addPolygon(const sf::Vector2f* points, size_t count,
+                                   const sf::Vector2f& position, float rotation,
+                                   const sf::Color& color) {
+    if (count < 3) return;
+
+    // Fan from the first vertex
+    Placement placement(position, rotation);
+    uint32_t first = static_cast<uint32_t>(pointBuffer.size());
+    sf::Vector2f anchor = placement.apply(points[0]);
+    sf::Vector2f previous = placement.apply(points[1]);
+    for (size_t i = 2; i < count; ++i) {
+        sf::Vector2f current = placement.apply(points[i]);
+        pointBuffer.push_back(anchor);
+        pointBuffer.push_back(previous);
+        pointBuffer.push_back(current);
+        previous = current;
+    }
+    push(Kind::Triangles, color, first, static_cast<uint32_t>(pointBuffer.size() - first));
+}
+
+void RenderCommandList::addCircle(const sf::Vector2f& center, float radius,
+                                  const sf::Color& color) {
+    Command& command = push(Kind::Circle, color, 0, 0);
+    command.position = center;
+    command.radius = radius;
+}
+
+void RenderCommandList::addText(std::string_view text, const sf::Vector2f& position,
+                                unsigned characterSize, const sf::Color& color, bool centered) {
+    uint32_t first = static_cast<uint32_t>(textBuffer.size());
+    textBuffer.insert(textBuffer.end(), text.begin(), text.end());
+
+    Command& command = push(Kind::Text, color, first, static_cast<uint32_t>(text.size()));
+    command.characterSize = static_cast<uint8_t>(characterSize);
+    command.centered = centered ? 1 : 0;
+    command.position = position;
+}
+
+sf::Vertex* RenderCommandList::addLines(size_t vertexCount) {
+    uint32_t first = static_cast<uint32_t>(vertexBuffer.size());
+    vertexBuffer.resize(first + vertexCount);
+    push(Kind::Lines, sf::Color::White, first, static_cast<uint32_t>(vertexCount));
+    return vertexBuffer.data() + first;
+}
+
+uint64_t RenderCommandList::hash() const {
+    uint64_t hash = FNV_OFFSET;
+    hash = fnv1a(hash, commandBuffer.data(), commandBuffer.size() * sizeof(Command));
+    hash = fnv1a(hash, pointBuffer.data(), pointBuffer.size() * sizeof(sf::Vector2f));
+    hash = fnv1a(hash, vertexBuffer.data(), vertexBuffer.size() * sizeof(sf::Vertex));
+    return fnv1a(hash, textBuffer.data(), textBuffer.size());
+}
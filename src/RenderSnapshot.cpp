@@ -0,0 +1,127 @@
+// src/RenderSnapshot.cpp
+#include "RenderSnapshot.hpp"
+#include <algorithm>
+#include <cmath>
+#include "Bullet.hpp"
+#include "GameObject.hpp"
+#include "Ship.hpp"
+#include "Vector2D.hpp"
+
+namespace {
+sf::Vector2f positionAt(const RenderSnapshot::Pose& pose, float alpha, const sf::Vector2f& world) {
+    return GameObject::interpolate(pose.previousPosition, pose.position, alpha, world);
+}
+
+float rotationAt(const RenderSnapshot::Pose& pose, float alpha) {
+    return pose.previousRotation + (pose.rotation - pose.previousRotation) * alpha;
+}
+
+constexpr float PARTICLE_DRAG = 1.5f;            // Per second
+constexpr float DEBRIS_PER_PIXEL = 1.2f;         // Particles per pixel of radius
+constexpr float DEBRIS_MIN_SPEED = 20.0f;
+constexpr float DEBRIS_MAX_SPEED = 160.0f;
+constexpr float DEBRIS_MIN_LIFETIME = 0.5f;
+constexpr float DEBRIS_MAX_LIFETIME = 1.2f;
+constexpr float EXHAUST_RATE = 400.0f;           // Particles per second of thrust
+constexpr float EXHAUST_SPREAD = 0.35f;          // Radians either side of straight back
+constexpr float EXHAUST_MIN_SPEED = 120.0f;
+constexpr float EXHAUST_MAX_SPEED = 220.0f;
+constexpr float EXHAUST_MIN_LIFETIME = 0.2f;
+constexpr float EXHAUST_MAX_LIFETIME = 0.4f;
+constexpr float EXHAUST_OFFSET = 22.0f * SHIP_SCALE;  // Behind the ship's centre, at the flame
+} // namespace
+
+void SnapshotRenderer::record(const RenderSnapshot& snapshot, float alpha, RenderCommandList& out) {
+    updateParticles(snapshot, alpha);
+
+    if (snapshot.hasShip) {
+        Ship::drawHull(out, positionAt(snapshot.ship, alpha, snapshot.worldSize), rotationAt(snapshot.ship, alpha),
+                       snapshot.thrusting);
+    }
+    for (const RenderSnapshot::Pose& bullet : snapshot.bullets) {
+        Bullet::drawAt(out, positionAt(bullet, alpha, snapshot.worldSize));
+    }
+    for (const RenderSnapshot::AsteroidView& asteroid : snapshot.asteroids) {
+        Asteroid::drawShape(out, asteroid.size, asteroid.shapeIndex,
+                            positionAt(asteroid.pose, alpha, snapshot.worldSize), rotationAt(asteroid.pose, alpha));
+    }
+
+    particles.draw(out);
+
+    hud.update(snapshot.score, snapshot.phase);
+    hud.draw(out);
+}
+
+void SnapshotRenderer::draw(sf::RenderTarget& target, const RenderSnapshot& snapshot, float alpha) {
+    commands.clear();
+    record(snapshot, alpha, commands);
+    backend.setWorldSize(snapshot.worldSize);
+    backend.submit(commands, target);
+}
+
+// The particle clock is the snapshot's tick plus alpha, so effects move
+// smoothly between ticks yet depend only on the snapshots drawn
+void SnapshotRenderer::updateParticles(const RenderSnapshot& snapshot, float alpha) {
+    const double now = (static_cast<double>(snapshot.tick) - 1.0 + alpha) * snapshot.tickStep;
+    if (particles.capacity() == 0) {
+        particles.setCapacity(PARTICLE_CAPACITY);
+        particles.setDrag(PARTICLE_DRAG);
+        particleTime = now;
+    }
+    if (snapshot.tick < effectsTick) {
+        // Another simulation, started afresh
+        particles.clear();
+        effectsTick = 0;
+        particleTime = now;
+    }
+    const float deltaTime = static_cast<float>(std::max(0.0, now - particleTime));
+    particleTime = std::max(particleTime, now);
+    particles.update(deltaTime);
+
+    for (const RenderSnapshot::Explosion& explosion : snapshot.explosions) {
+        if (explosion.tick > effectsTick) {
+            emitDebris(explosion);
+        }
+    }
+    effectsTick = snapshot.tick;
+
+    if (snapshot.hasShip && snapshot.thrusting) {
+        emitExhaust(positionAt(snapshot.ship, alpha, snapshot.worldSize),
+                    rotationAt(snapshot.ship, alpha), deltaTime);
+    } else {
+        exhaustOwed = 0.0f;
+    }
+}
+
+void SnapshotRenderer::emitDebris(const RenderSnapshot::Explosion& explosion) {
+    const int count = static_cast<int>(explosion.radius * DEBRIS_PER_PIXEL);
+    for (int i = 0; i < count; ++i) {
+        float angle = effectsRng.uniform(0.0f, 2.0f * M_PI);
+        float speed = effectsRng.uniform(DEBRIS_MIN_SPEED, DEBRIS_MAX_SPEED);
+        sf::Vector2f direction = vec2::fromAngle(angle);
+        sf::Uint8 shade = static_cast<sf::Uint8>(effectsRng.range(150, 255));
+        particles.emit(explosion.position + direction * effectsRng.uniform(0.0f, explosion.radius),
+                       explosion.velocity + direction * speed,
+                       effectsRng.uniform(DEBRIS_MIN_LIFETIME, DEBRIS_MAX_LIFETIME),
+                       sf::Color(shade, shade, shade));
+    }
+}
+
+// Rotation 0 faces up the screen, so the exhaust leaves along +y in ship space
+void SnapshotRenderer::emitExhaust(const sf::Vector2f& position, float rotation, float deltaTime) {
+    exhaustOwed += EXHAUST_RATE * deltaTime;
+    const int count = static_cast<int>(exhaustOwed);
+    exhaustOwed -= count;
+
+    const float backward = vec2::toRadians(rotation + 90.0f);
+    const sf::Vector2f nozzle =
+        position + sf::Vector2f(vec2::fromAngle(backward) * EXHAUST_OFFSET);
+    for (int i = 0; i < count; ++i) {
+        float angle = backward + effectsRng.uniform(-EXHAUST_SPREAD, EXHAUST_SPREAD);
+        float speed = effectsRng.uniform(EXHAUST_MIN_SPEED, EXHAUST_MAX_SPEED);
+        sf::Uint8 green = static_cast<sf::Uint8>(effectsRng.range(120, 230));
+        particles.emit(nozzle, vec2::fromAngle(angle) * speed,
+                       effectsRng.uniform(EXHAUST_MIN_LIFETIME, EXHAUST_MAX_LIFETIME),
+                       sf::Color(255, green, 40));
+    }
+}
@@ -0,0 +1,90 @@
+// src/ThreadPool.cpp
+#include "ThreadPool.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace {
+// Waits are timed so they stay on the steady clock; a timeout just re-checks
+constexpr std::chrono::milliseconds WAIT_SLICE(100);
+}
+
+ThreadPool::ThreadPool(size_t threadCount) {
+    if (threadCount == 0) {
+        threadCount = std::max(1u, std::thread::hardware_concurrency());
+    }
+    workers.reserve(threadCount - 1);
+    for (size_t i = 1; i < threadCount; ++i) {
+        workers.emplace_back(&ThreadPool::workerLoop, this);
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    wake.notify_all();
+    for (auto& worker : workers) {
+        worker.join();
+    }
+}
+
+void ThreadPool::dispatch(size_t count, size_t grain, TaskFn task, void* context) {
+    if (count == 0) return;
+    grain = std::max<size_t>(grain, 1);
+
+    // Not worth waking anyone for a single chunk
+    if (workers.empty() || count <= grain) {
+        for (size_t i = 0; i < count; ++i) {
+            task(context, i);
+        }
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        job = Job{count, grain, task, context};
+        nextIndex.store(0, std::memory_order_relaxed);
+        activeWorkers = workers.size();
+        ++generation;
+    }
+    wake.notify_all();
+
+    runJob(job);
+
+    std::unique_lock<std::mutex> lock(mutex);
+    while (!done.wait_for(lock, WAIT_SLICE, [this] { return activeWorkers == 0; })) {}
+}
+
+void ThreadPool::runJob(const Job& current) {
+    for (;;) {
+        size_t begin = nextIndex.fetch_add(current.grain, std::memory_order_relaxed);
+        if (begin >= current.count) return;
+        size_t end = std::min(begin + current.grain, current.count);
+        for (size_t i = begin; i < end; ++i) {
+            current.task(current.context, i);
+        }
+    }
+}
+
+void ThreadPool::workerLoop() {
+    size_t seenGeneration = 0;
+    for (;;) {
+        Job current;
+        {
+            std::unique_lock<std::mutex> lock(mutex);
+            while (!wake.wait_for(lock, WAIT_SLICE,
+                                  [&] { return stopping || generation != seenGeneration; })) {}
+            if (stopping) return;
+            seenGeneration = generation;
+            current = job;
+        }
+
+        runJob(current);
+
+        std::lock_guard<std::mutex> lock(mutex);
+        if (--activeWorkers == 0) {
+            done.notify_one();
+        }
+    }
+}
@@ -0,0 +1,77 @@
+// src/Vector2D.cpp
+#include "Vector2D.hpp"
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// The SSE paths use only correctly rounded operations (add, mul) in the
+// scalar order and finish the tail with the scalar kernels, so both give
+// identical results. SSE2 is part of x86-64, so every 64-bit
+// x86 build takes it; other targets fall back to the scalar loops.
+
+namespace vec2 {
+
+namespace scalar {
+
+void integrate(float* x, float* y, const float* vx, const float* vy, size_t count,
+               float deltaTime) {
+    for (size_t i = 0; i < count; ++i) {
+        x[i] += vx[i] * deltaTime;
+        y[i] += vy[i] * deltaTime;
+    }
+}
+
+void lengthsSq(const float* x, const float* y, float* out, size_t count) {
+    for (size_t i = 0; i < count; ++i) {
+        out[i] = lengthSq(Vec2(x[i], y[i]));
+    }
+}
+
+} // namespace scalar
+
+#if defined(__SSE2__)
+
+const size_t SIMD_WIDTH = 4;
+
+namespace {
+inline __m128 lengthSq4(__m128 x, __m128 y) {
+    return _mm_add_ps(_mm_mul_ps(x, x), _mm_mul_ps(y, y));
+}
+} // namespace
+
+void integrate(float* x, float* y, const float* vx, const float* vy, size_t count,
+               float deltaTime) {
+    const __m128 dt = _mm_set1_ps(deltaTime);
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(x + i, _mm_add_ps(_mm_loadu_ps(x + i), _mm_mul_ps(_mm_loadu_ps(vx + i), dt)));
+        _mm_storeu_ps(y + i, _mm_add_ps(_mm_loadu_ps(y + i), _mm_mul_ps(_mm_loadu_ps(vy + i), dt)));
+    }
+    scalar::integrate(x + i, y + i, vx + i, vy + i, count - i, deltaTime);
+}
+
+void lengthsSq(const float* x, const float* y, float* out, size_t count) {
+    size_t i = 0;
+    for (; i + 4 <= count; i += 4) {
+        _mm_storeu_ps(out + i, lengthSq4(_mm_loadu_ps(x + i), _mm_loadu_ps(y + i)));
+    }
+    scalar::lengthsSq(x + i, y + i, out + i, count - i);
+}
+
+#else
+
+const size_t SIMD_WIDTH = 1;
+
+void integrate(float* x, float* y, const float* vx, const float* vy, size_t count,
+               float deltaTime) {
+    scalar::integrate(x, y, vx, vy, count, deltaTime);
+}
+
+void lengthsSq(const float* x, const float* y, float* out, size_t count) {
+    scalar::lengthsSq(x, y, out, count);
+}
+
+#endif
+
+} // namespace vec2
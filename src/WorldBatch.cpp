@@ -0,0 +1,75 @@
+// src/WorldBatch.cpp
+#include "WorldBatch.hpp"
+#include "Profiler.hpp"
+
+WorldBatch::WorldBatch(size_t worldCount, uint32_t baseSeed, const InputFactory& makeInput,
+                       std::shared_ptr<const WorldConfig> config) {
+    if (!config) {
+        config = std::make_shared<const WorldConfig>();
+    }
+    worlds.resize(worldCount);
+    for (size_t i = 0; i < worldCount; ++i) {
+        worlds[i].state = std::make_unique<GameState>(makeInput(i), worldSeed(baseSeed, i), config);
+    }
+}
+
+uint32_t WorldBatch::worldSeed(uint32_t baseSeed, size_t worldIndex) {
+    // Golden-ratio stride keeps neighbouring worlds' seeds far apart
+    return baseSeed + static_cast<uint32_t>(worldIndex) * 0x9E3779B9u;
+}
+
+void WorldBatch::step(ThreadPool& pool, long ticks, float deltaTime) {
+    // A lone world has nothing to run beside it, so it gets the whole pool
+    // for its collision phase instead
+    if (worlds.size() == 1) {
+        GameState& state = *worlds[0].state;
+        state.setThreadPool(&pool);
+        stepWorld(worlds[0], ticks, deltaTime);
+        state.setThreadPool(nullptr);
+        return;
+    }
+
+    // GameState::update can throw, bad_alloc at least, and parallelFor's
+    // tasks must not. Workers profile their worlds if the caller does.
+    const bool profiled = Profiler::COMPILED_IN && Profiler::isThreadAttached();
+    pool.parallelForCatching(worlds.size(), [&](size_t index) {
+        if (profiled) Profiler::attachThisThread();
+        stepWorld(worlds[index], ticks, deltaTime);
+    });
+}
+
+void WorldBatch::stepWorld(World& world, long ticks, float deltaTime) {
+    GameState& state = *world.state;
+    for (long tick = 0; tick < ticks; ++tick) {
+        bool wasOver = state.isGameOver();
+        bool wasWon = state.isGameWon();
+        state.update(deltaTime);
+        if (!wasOver && state.isGameOver()) ++world.stats.gameOvers;
+        if (!wasWon && state.isGameWon()) ++world.stats.wins;
+    }
+    world.stats.ticks += ticks;
+}
+
+long WorldBatch::totalTicks() const {
+    long total = 0;
+    for (const auto& world : worlds) total += world.stats.ticks;
+    return total;
+}
+
+long WorldBatch::totalGameOvers() const {
+    long total = 0;
+    for (const auto& world : worlds) total += world.stats.gameOvers;
+    return total;
+}
+
+long WorldBatch::totalWins() const {
+    long total = 0;
+    for (const auto& world : worlds) total += world.stats.wins;
+    return total;
+}
+
+long WorldBatch::totalScore() const {
+    long total = 0;
+    for (const auto& world : worlds) total += world.state->getScore();
+    return total;
+}
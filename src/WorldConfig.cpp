@@ -0,0 +1,203 @@
+// src/WorldConfig.cpp
+#include "WorldConfig.hpp"
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <stdexcept>
+
+namespace {
+
+// File keys, in the order toString() writes them
+struct FloatField { const char* key; float WorldConfig::*member; };
+struct IntField { const char* key; int WorldConfig::*member; };
+
+const FloatField FLOAT_FIELDS[] = {
+    {"width", &WorldConfig::width},
+    {"height", &WorldConfig::height},
+    {"tick_rate", &WorldConfig::tickRate},
+    {"asteroid_min_speed", &WorldConfig::asteroidMinSpeed},
+    {"asteroid_max_speed", &WorldConfig::asteroidMaxSpeed},
+    {"ship_rotation_speed", &WorldConfig::shipRotationSpeed},
+    {"ship_acceleration", &WorldConfig::shipAcceleration},
+    {"ship_max_speed", &WorldConfig::shipMaxSpeed},
+    {"bullet_speed", &WorldConfig::bulletSpeed},
+    {"fire_interval", &WorldConfig::fireInterval},
+};
+
+const IntField INT_FIELDS[] = {
+    {"asteroids", &WorldConfig::asteroidCount},
+    {"max_bullets", &WorldConfig::maxBullets},
+    {"split_fan_out", &WorldConfig::splitFanOut},
+};
+
+std::string trim(const std::string& text) {
+    size_t first = text.find_first_not_of(" \t\r");
+    if (first == std::string::npos) return "";
+    size_t last = text.find_last_not_of(" \t\r");
+    return text.substr(first, last - first + 1);
+}
+
+// Stress worlds pack about one large asteroid per 70x70 px, enough to keep
+// the broadphase and the split path busy from the first tick
+WorldConfig stress(float width, float height, int asteroids) {
+    WorldConfig config;
+    config.width = width;
+    config.height = height;
+    config.asteroidCount = asteroids;
+    return config;
+}
+
+} // namespace
+
+const WorldConfig& WorldConfig::defaults() {
+    static const WorldConfig config;
+    return config;
+}
+
+const std::vector<std::string>& WorldConfig::presetNames() {
+    static const std::vector<std::string> names = {"classic", "10k", "100k", "1m", "bullet-hell"};
+    return names;
+}
+
+WorldConfig WorldConfig::preset(const std::string& name) {
+    if (name == "classic") return WorldConfig{};
+    if (name == "10k") return stress(8000.0f, 6000.0f, 10000);
+    if (name == "100k") return stress(25600.0f, 19200.0f, 100000);
+    if (name == "1m") return stress(80000.0f, 60000.0f, 1000000);
+    if (name == "bullet-hell") {
+        WorldConfig config;
+        config.asteroidCount = 40;
+        config.maxBullets = 1000;
+        config.bulletSpeed = 700.0f;
+        config.fireInterval = 0.01f;
+        config.splitFanOut = 3;
+        return config;
+    }
+    throw std::invalid_argument("Unknown preset: " + name);
+}
+
+void WorldConfig::set(const std::string& key, const std::string& value) {
+    std::istringstream in(value);
+    for (const auto& field : FLOAT_FIELDS) {
+        if (key != field.key) continue;
+        float parsed;
+        if (!(in >> parsed) || !(in >> std::ws).eof()) {
+            throw std::invalid_argument("Bad number for " + key + ": " + value);
+        }
+        this->*field.member = parsed;
+        return;
+    }
+    for (const auto& field : INT_FIELDS) {
+        if (key != field.key) continue;
+        int parsed;
+        if (!(in >> parsed) || !(in >> std::ws).eof()) {
+            throw std::invalid_argument("Bad integer for " + key + ": " + value);
+        }
+        this->*field.member = parsed;
+        return;
+    }
+    throw std::invalid_argument("Unknown setting: " + key);
+}
+
+void WorldConfig::apply(const std::string& assignment) {
+    size_t equals = assignment.find('=');
+    if (equals == std::string::npos) {
+        throw std::invalid_argument("Expected key=value, got: " + assignment);
+    }
+    set(trim(assignment.substr(0, equals)), trim(assignment.substr(equals + 1)));
+}
+
+WorldConfig WorldConfig::fromFile(const std::string& path) {
+    std::ifstream file(path);
+    if (!file) {
+        throw std::runtime_error("Cannot read world config: " + path);
+    }
+
+    WorldConfig config;
+    std::string line;
+    for (int number = 1; std::getline(file, line); ++number) {
+        line = trim(line.substr(0, line.find('#')));
+        if (line.empty()) continue;
+        try {
+            config.apply(line);
+        } catch (const std::invalid_argument& e) {
+            throw std::runtime_error(path + ":" + std::to_string(number) + ": " + e.what());
+        }
+    }
+    return config;
+}
+
+bool WorldConfig::parseArgument(int argc, char* argv[], int& i, WorldConfig& config) {
+    if (i + 1 >= argc) return false;
+    if (std::strcmp(argv[i], "--config") == 0) {
+        config = fromFile(argv[++i]);
+    } else if (std::strcmp(argv[i], "--preset") == 0) {
+        config = preset(argv[++i]);
+    } else if (std::strcmp(argv[i], "--set") == 0) {
+        config.apply(argv[++i]);
+    } else {
+        return false;
+    }
+    return true;
+}
+
+const char* WorldConfig::usage() {
+    return "[--config FILE] [--preset classic|10k|100k|1m|bullet-hell] [--set key=value]...";
+}
+
+void WorldConfig::validate() const {
+    for (const auto& field : FLOAT_FIELDS) {
+        if (!std::isfinite(this->*field.member)) {
+            throw std::invalid_argument(std::string(field.key) + " must be finite");
+        }
+    }
+    if (!(width > 0.0f && height > 0.0f)) {
+        throw std::invalid_argument("World size must be positive");
+    }
+    const double cells = std::ceil(width / ASTEROID_GRID_CELL_SIZE) *
+                         std::ceil(height / ASTEROID_GRID_CELL_SIZE);
+    if (width > MAX_WORLD_SIDE || height > MAX_WORLD_SIDE || cells > MAX_GRID_CELLS) {
+        throw std::invalid_argument("World too large for its asteroid grid");
+    }
+    if (!(tickRate > 0.0f)) {
+        throw std::invalid_argument("tick_rate must be positive");
+    }
+    if (asteroidCount < 0 || maxBullets < 0 || splitFanOut < 0) {
+        throw std::invalid_argument("Counts can't be negative");
+    }
+    if (asteroidMinSpeed < 0.0f || asteroidMaxSpeed < asteroidMinSpeed) {
+        throw std::invalid_argument("Asteroid speeds must satisfy 0 <= min <= max");
+    }
+    if (bulletSpeed <= 0.0f || fireInterval < 0.0f) {
+        throw std::invalid_argument("bullet_speed must be positive and fire_interval not negative");
+    }
+}
+
+std::string WorldConfig::toString() const {
+    std::ostringstream out;
+    for (const auto& field : FLOAT_FIELDS) {
+        out << field.key << " = " << this->*field.member << '\n';
+    }
+    for (const auto& field : INT_FIELDS) {
+        out << field.key << " = " << this->*field.member << '\n';
+    }
+    return out.str();
+}
+
+uint32_t WorldConfig::hash() const {
+    uint32_t hash = 2166136261u;
+    auto mix = [&hash](const void* value, size_t size) {
+        const unsigned char* bytes = static_cast<const unsigned char*>(value);
+        for (size_t i = 0; i < size; ++i) {
+            hash = (hash ^ bytes[i]) * 16777619u;
+        }
+    };
+    for (const auto& field : FLOAT_FIELDS) {
+        mix(&(this->*field.member), sizeof(float));
+    }
+    for (const auto& field : INT_FIELDS) {
+        mix(&(this->*field.member), sizeof(int));
+    }
+    return hash;
+}
@@ -0,0 +1,246 @@
+// src/headless_main.cpp
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "HeadlessRenderer.hpp"
+#include "InputRecording.hpp"
+#include "InputSource.hpp"
+#include "Profiler.hpp"
+#include "ThreadPool.hpp"
+#include "WorldBatch.hpp"
+#include "WorldConfig.hpp"
+
+// Steps one or more GameStates as fast as the CPU allows with a fixed
+// timestep, without opening a window. Used for soak runs, regression timing
+// and Monte Carlo batches spread over a thread pool, or to fast-forward
+// through a recorded session.
+
+namespace {
+
+struct Options {
+    long ticks = 100000;
+    bool ticksGiven = false;
+    float deltaTime = 0.0f;    // 0 = one tick at the config's tick rate
+    std::string input = "scripted";
+    long worlds = 1;
+    long threads = 1;          // 0 = one per core
+    uint32_t seed = std::random_device{}();
+    std::string replayPath;
+    std::string profilePrefix;
+    bool render = false;
+    WorldConfig world;
+};
+
+void printUsage(const char* program) {
+    std::cerr << "Usage: " << program << " [--ticks N] [--dt SECONDS] [--input scripted|null]\n"
+              << "       [--worlds N] [--threads N] [--seed S] [--profile PREFIX]\n"
+              << "       " << program << " --replay FILE [--ticks N] [--profile PREFIX] [--render]\n"
+              << "World options, for either form: " << WorldConfig::usage() << "\n"
+              << "A replay needs the world options it was recorded with.\n";
+}
+
+bool parseOptions(int argc, char* argv[], Options& options) {
+    for (int i = 1; i < argc; ++i) {
+        bool hasValue = i + 1 < argc;
+        if (std::strcmp(argv[i], "--ticks") == 0 && hasValue) {
+            options.ticks = std::atol(argv[++i]);
+            options.ticksGiven = true;
+        } else if (std::strcmp(argv[i], "--dt") == 0 && hasValue) {
+            options.deltaTime = static_cast<float>(std::atof(argv[++i]));
+        } else if (std::strcmp(argv[i], "--input") == 0 && hasValue) {
+            options.input = argv[++i];
+        } else if (std::strcmp(argv[i], "--worlds") == 0 && hasValue) {
+            options.worlds = std::atol(argv[++i]);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && hasValue) {
+            options.threads = std::atol(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && hasValue) {
+            options.seed = static_cast<uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (std::strcmp(argv[i], "--replay") == 0 && hasValue) {
+            options.replayPath = argv[++i];
+        } else if (std::strcmp(argv[i], "--profile") == 0 && hasValue) {
+            options.profilePrefix = argv[++i];
+        } else if (std::strcmp(argv[i], "--render") == 0) {
+            options.render = true;
+        } else if (WorldConfig::parseArgument(argc, argv, i, options.world)) {
+            continue;
+        } else {
+            return false;
+        }
+    }
+    options.world.validate();
+    if (options.deltaTime == 0.0f) {
+        options.deltaTime = options.world.tickStep();
+    }
+    return options.ticks > 0 && options.deltaTime > 0.0f &&
+           options.worlds > 0 && options.threads >= 0 &&
+           (options.input == "scripted" || options.input == "null") &&
+           (!options.render || !options.replayPath.empty());
+}
+
+// A pilot that spins, thrusts in bursts, fires steadily and restarts when dead
+std::vector<InputState> demoScript() {
+    std::vector<InputState> script(120);
+    for (size_t tick = 0; tick < script.size(); ++tick) {
+        script[tick].rotateRight = true;
+        script[tick].thrust = tick < 20;
+        script[tick].fire = tick % 10 < 5;
+        script[tick].restart = true;
+    }
+    return script;
+}
+
+// Records this thread's share of the run; WorldBatch attaches the pool
+// workers that step the other worlds, each as its own trace thread
+void beginProfile(const Options& options) {
+    if (options.profilePrefix.empty()) return;
+    if (!Profiler::COMPILED_IN) {
+        std::cerr << "Warning: profiler compiled out, configure with -DASTEROIDS_PROFILE=ON\n";
+        return;
+    }
+    Profiler::attachThisThread();
+    Profiler::instance().startCapture();
+}
+
+void endProfile(const Options& options) {
+    if (options.profilePrefix.empty() || !Profiler::COMPILED_IN) return;
+
+    Profiler& profiler = Profiler::instance();
+    profiler.stopCapture();
+    std::string tracePath = options.profilePrefix + ".json";
+    std::string csvPath = options.profilePrefix + ".csv";
+    if (!profiler.writeChromeTrace(tracePath) || !profiler.writeCsv(csvPath)) {
+        std::cerr << "Failed to write " << tracePath << " / " << csvPath << "\n";
+    }
+
+    char line[160];
+    std::cout << "profile:        " << tracePath << ", " << csvPath << " ("
+              << profiler.capturedEvents() << " events)\n";
+    for (const Profiler::PhaseStats& phase : profiler.stats()) {
+        std::snprintf(line, sizeof(line),
+                      "  %-28s n %9llu  p50 %8.2fus  p99 %8.2fus  max %9.2fus\n", phase.name,
+                      static_cast<unsigned long long>(phase.count), phase.p50Us, phase.p99Us,
+                      phase.maxUs);
+        std::cout << line;
+    }
+}
+
+// Plays a recording through one world with its own seed and step
+int runReplay(const Options& options) {
+    auto recording = std::make_shared<const InputRecording>(options.replayPath);
+    if (!recording->recordedWith(options.world)) {
+        throw std::runtime_error(options.replayPath +
+                                 " was recorded with different world options");
+    }
+    long ticks = static_cast<long>(recording->getTickCount());
+    if (options.ticksGiven) {
+        ticks = std::min(ticks, options.ticks);
+    }
+
+    GameState gameState(std::make_unique<ReplayInput>(recording), recording->getSeed(),
+                        std::make_shared<const WorldConfig>(options.world));
+    float step = recording->getStepSeconds();
+    long gameOvers = 0;
+
+    // --render records every tick's frame and fingerprints it, no window needed
+    RenderCommandList commands;
+    HeadlessRenderer headless;
+
+    beginProfile(options);
+    auto start = std::chrono::steady_clock::now();
+    for (long tick = 0; tick < ticks; ++tick) {
+        bool wasOver = gameState.isGameOver();
+        gameState.update(step);
+        if (!wasOver && gameState.isGameOver()) {
+            ++gameOvers;
+        }
+        if (options.render) {
+            commands.clear();
+            gameState.draw(commands);
+            headless.submit(commands);
+        }
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    double simulated = ticks * static_cast<double>(step);
+    std::cout << "replay:         " << options.replayPath << "\n"
+              << "seed:           " << recording->getSeed() << "\n"
+              << "ticks:          " << ticks << " of " << recording->getTickCount()
+              << " (" << recording->getRunCount() << " runs)\n"
+              << "simulated time: " << simulated << " s\n"
+              << "wall time:      " << elapsed << " s\n"
+              << "speed:          " << (elapsed > 0.0 ? simulated / elapsed : 0.0) << "x real time\n"
+              << "game overs:     " << gameOvers << "\n"
+              << "final score:    " << gameState.getScore() << "\n";
+    if (options.render) {
+        const HeadlessRenderer::Counts& totals = headless.totals();
+        std::cout << "frames:         " << headless.frameCount() << "\n"
+                  << "primitives:     " << totals.lineSegments << " line segments, "
+                  << totals.triangles << " triangles, " << totals.circles << " circles, "
+                  << totals.lines << " particle streaks, " << totals.textRuns << " text runs\n"
+                  << "frame digest:   " << std::hex << headless.sessionDigest() << std::dec << "\n";
+    }
+    endProfile(options);
+    return 0;
+}
+
+} // namespace
+
+int main(int argc, char* argv[]) {
+    Options options;
+    try {
+        if (!parseOptions(argc, argv, options)) {
+            printUsage(argv[0]);
+            return 1;
+        }
+    } catch (const std::exception& e) {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return 1;
+    }
+
+    if (!options.replayPath.empty()) {
+        try {
+            return runReplay(options);
+        } catch (const std::exception& e) {
+            std::cerr << "Error: " << e.what() << std::endl;
+            return 1;
+        }
+    }
+
+    WorldBatch batch(static_cast<size_t>(options.worlds), options.seed,
+        [&options](size_t) -> std::unique_ptr<InputSource> {
+            if (options.input == "null") {
+                return std::make_unique<NullInput>();
+            }
+            return std::make_unique<ScriptedInput>(demoScript());
+        },
+        std::make_shared<const WorldConfig>(options.world));
+    ThreadPool pool(static_cast<size_t>(options.threads));
+
+    beginProfile(options);
+    auto start = std::chrono::steady_clock::now();
+    batch.step(pool, options.ticks, options.deltaTime);
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    long totalTicks = batch.totalTicks();
+    std::cout << "worlds:         " << batch.size() << " of " << options.world.width << "x"
+              << options.world.height << " with " << options.world.asteroidCount << " asteroids\n"
+              << "threads:        " << pool.size() << "\n"
+              << "seed:           " << options.seed << "\n"
+              << "ticks/world:    " << options.ticks << "\n"
+              << "simulated time: " << options.ticks * options.deltaTime << " s per world\n"
+              << "wall time:      " << elapsed << " s\n"
+              << "ticks/second:   " << (elapsed > 0.0 ? totalTicks / elapsed : 0.0) << "\n"
+              << "game overs:     " << batch.totalGameOvers() << "\n"
+              << "wins:           " << batch.totalWins() << "\n"
+              << "total score:    " << batch.totalScore() << "\n";
+    endProfile(options);
+    return 0;
+}
@@ -1,78 +1,364 @@
 // src/main.cpp
 #include <SFML/Graphics.hpp>
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
 #include <memory>
 #include <iostream>
+#include <random>
+#include <string>
+#include <thread>
 #include "Constants.hpp"
+#include "FixedTimestep.hpp"
 #include "GameState.hpp"
+#include "InputRecording.hpp"
+#include "Profiler.hpp"
+#include "RenderSnapshot.hpp"
+#include "TripleBuffer.hpp"
+#include "WorldConfig.hpp"
 
 class Game {
 public:
-    Game() : window(sf::VideoMode::getFullscreenModes()[0], WINDOW_TITLE, sf::Style::Fullscreen) {
+    // A non-empty recordPath saves the session for asteroids_headless --replay.
+    // threaded moves the simulation off the render thread. The world is
+    // scaled to fit the window, fullscreen unless windowed.
+    Game(const WorldConfig& world, int maxCatchUpSteps, const std::string& recordPath,
+         bool threaded, bool windowed)
+        : window(videoMode(world, windowed), WINDOW_TITLE,
+                 windowed ? sf::Style::Default : sf::Style::Fullscreen),
+          timestep(world.tickRate, maxCatchUpSteps), threaded(threaded) {
 
-        if (!font.loadFromFile(FONT_PATH)) {
+        // Initialize game state
+        uint32_t seed = std::random_device{}();
+        std::unique_ptr<InputSource> input = std::make_unique<KeyboardInput>();
+        if (!recordPath.empty()) {
+            input = std::make_unique<RecordingInput>(std::move(input),
+                std::make_unique<InputRecorder>(recordPath, seed, timestep.getStep(), world));
+        }
+        gameState = std::make_unique<GameState>(std::move(input), seed,
+                                                std::make_shared<const WorldConfig>(world));
+        gameState->setMaxCatchUpSteps(maxCatchUpSteps);
+
+        // The debug overlay shares the game's font rather than loading its own
+        const sf::Font* font = gameState->getFont();
+        if (!font) {
             throw std::runtime_error("Failed to load font!");
         }
 
         // Set up debug text
-        debugText.setFont(font);
-        debugText.setCharacterSize(24);
+        debugText.setFont(*font);
         debugText.setFillColor(sf::Color::White);
-        debugText.setPosition(10.f, 10.f);
-        // debugText.setString("Press Esc to exit");
+        debugText.setCharacterSize(12);
+        debugText.setPosition(10.f, WINDOW_HEIGHT - 22.f);
 
-        // Initialize game state
-        gameState = std::make_unique<GameState>();
+        profileText.setFont(*font);
+        profileText.setFillColor(sf::Color::Yellow);
+        profileText.setCharacterSize(12);
+        profileText.setPosition(10.f, 40.f);
+
+        snapshotRenderer.setFont(*font);
+
+        Profiler::attachThisThread();
+    }
+
+    ~Game() {
+        stopSimulation();
+        if (Profiler::instance().isCapturing()) {
+            stopCapture();
+        }
     }
 
     void run() {
+        if (threaded) {
+            runThreaded();
+        } else {
+            runSingleThreaded();
+        }
+        printFrameStats();
+    }
+
+private:
+    using SteadyClock = std::chrono::steady_clock;
+
+    // Windows keep the world's aspect ratio, shrunk to fit the desktop
+    static sf::VideoMode videoMode(const WorldConfig& world, bool windowed) {
+        if (!windowed) {
+            return sf::VideoMode::getFullscreenModes()[0];
+        }
+        sf::VideoMode desktop = sf::VideoMode::getDesktopMode();
+        float scale = std::min({1.0f, 0.9f * desktop.width / world.width,
+                                0.9f * desktop.height / world.height});
+        return sf::VideoMode(static_cast<unsigned>(world.width * scale),
+                             static_cast<unsigned>(world.height * scale));
+    }
+
+    sf::RenderWindow window;
+    sf::Text debugText;
+    FixedTimestep timestep;
+    std::unique_ptr<GameState> gameState;
+    int shownDrawCalls = -1;
+    int shownHudRebuilds = -1;
+
+    // Frame and tick times in nanoseconds. Each histogram belongs to the
+    // thread that fills it; the render thread only sees tick stats as
+    // copied into snapshots.
+    LatencyHistogram frameTimes;
+    LatencyHistogram tickTimes;
+    static constexpr uint64_t STATS_TICKS = 16;   // Ticks between tickStats refreshes
+    FrameStats tickStats;
+    FrameStats shownTickStats;
+    sf::Clock statsRefresh;
+
+    // Two-thread mode: the simulation publishes snapshots, rendering draws the newest
+    bool threaded;
+    TripleBuffer<RenderSnapshot> snapshots;
+    SnapshotRenderer snapshotRenderer;
+    std::thread simulationThread;
+    std::atomic<bool> simulating{false};
+
+    // Profiler overlay (F3) and trace capture (F4)
+    static constexpr float PROFILE_REFRESH_SECONDS = 0.5f;
+    sf::Text profileText;
+    sf::Clock profileRefresh;
+    bool showProfile = false;
+
+    void runSingleThreaded() {
         sf::Clock clock;
         
         while (window.isOpen()) {
-            float deltaTime = clock.restart().asSeconds();
+            PROFILE_SCOPE("Frame");
+            sf::Time frameTime = clock.restart();
+            frameTimes.add(static_cast<uint64_t>(frameTime.asMicroseconds()) * 1000);
             
             processEvents();
-            update(deltaTime);
-            render();
+
+            // Simulate in fixed steps, then draw between the last two states
+            int steps = timestep.advance(frameTime.asSeconds());
+            for (int i = 0; i < steps; ++i) {
+                update(timestep.getStep());
+            }
+            window.clear(sf::Color::Black);
+            gameState->draw(window, timestep.getAlpha());
+            render(gameState->getDrawCalls(), gameState->getHudRebuilds(), tickStats);
         }
     }
 
-private:
-    sf::RenderWindow window;
-    sf::Font font;
-    sf::Text debugText;
-    std::unique_ptr<GameState> gameState;
+    // The simulation runs on its own thread, so display() and vsync waits
+    // never hold up ticks and slow ticks never hold up presenting frames
+    void runThreaded() {
+        // timestep belongs to the simulation thread from here on
+        const float step = timestep.getStep();
+        simulating = true;
+        simulationThread = std::thread([this] { simulate(); });
+
+        sf::Clock clock;
+        while (window.isOpen() && simulating.load(std::memory_order_relaxed)) {
+            PROFILE_SCOPE("Frame");
+            frameTimes.add(static_cast<uint64_t>(clock.restart().asMicroseconds()) * 1000);
+
+            processEvents();
+
+            snapshots.acquire();
+            const RenderSnapshot& snapshot = snapshots.readBuffer();
+            std::chrono::duration<float> sinceTick = SteadyClock::now() - snapshot.simulatedAt;
+            float alpha = std::clamp(sinceTick.count() / step, 0.0f, 1.0f);
+
+            window.clear(sf::Color::Black);
+            snapshotRenderer.draw(window, snapshot, alpha);
+            render(snapshotRenderer.getDrawCalls(), snapshotRenderer.getHudRebuilds(),
+                   snapshot.simulation);
+        }
+        stopSimulation();
+    }
+
+    // Simulation thread body: owns gameState, timestep and tickTimes until joined
+    void simulate() {
+        Profiler::attachThisThread();
+        try {
+            SteadyClock::time_point last = SteadyClock::now();
+            while (simulating.load(std::memory_order_relaxed)) {
+                SteadyClock::time_point now = SteadyClock::now();
+                int steps = timestep.advance(std::chrono::duration<float>(now - last).count());
+                last = now;
+
+                if (steps > 0) {
+                    for (int i = 0; i < steps; ++i) {
+                        update(timestep.getStep());
+                    }
+
+                    // The newest state belongs to the last whole step, not to now
+                    RenderSnapshot& out = snapshots.writeBuffer();
+                    gameState->captureRenderSnapshot(out);
+                    out.simulatedAt = now - std::chrono::duration_cast<SteadyClock::duration>(
+                        std::chrono::duration<float>(timestep.getAlpha() * timestep.getStep()));
+                    out.simulation = tickStats;
+                    snapshots.publish();
+                }
+
+                // Sleep until the next step is due
+                float untilNextStep = (1.0f - timestep.getAlpha()) * timestep.getStep();
+                std::this_thread::sleep_for(std::chrono::duration<float>(untilNextStep));
+            }
+        } catch (const std::exception& e) {
+            std::cerr << "Simulation error: " << e.what() << std::endl;
+        }
+        simulating = false;
+    }
+
+    void stopSimulation() {
+        simulating = false;
+        if (simulationThread.joinable()) {
+            simulationThread.join();
+        }
+    }
 
     void processEvents() {
+        PROFILE_SCOPE("Game::processEvents");
         sf::Event event;
         while (window.pollEvent(event)) {
             if (event.type == sf::Event::Closed ||
                 (event.type == sf::Event::KeyPressed && 
                  event.key.code == sf::Keyboard::Escape)) {
                 window.close();
+            } else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F3) {
+                showProfile = !showProfile;
+                refreshProfileText();
+            } else if (event.type == sf::Event::KeyPressed && event.key.code == sf::Keyboard::F4) {
+                if (Profiler::instance().isCapturing()) {
+                    stopCapture();
+                } else {
+                    Profiler::instance().startCapture();
+                }
             }
         }
     }
 
+    void stopCapture() {
+        Profiler& profiler = Profiler::instance();
+        profiler.stopCapture();
+        if (!profiler.writeChromeTrace(PROFILE_TRACE_PATH) ||
+            !profiler.writeCsv(PROFILE_CSV_PATH)) {
+            std::cerr << "Failed to write profile capture" << std::endl;
+        }
+    }
+
+    // Show the last refresh window's timings, then start a new window
+    void refreshProfileText() {
+        profileRefresh.restart();
+        if (!Profiler::COMPILED_IN) {
+            profileText.setString("Profiler compiled out (configure with -DASTEROIDS_PROFILE=ON)");
+            return;
+        }
+
+        Profiler& profiler = Profiler::instance();
+        std::string text = profiler.isCapturing() ? "Capturing (F4 to stop)\n" : "";
+        char line[128];
+        for (const Profiler::PhaseStats& phase : profiler.stats()) {
+            std::snprintf(line, sizeof(line), "%-28s p50 %8.1fus  p99 %8.1fus  max %8.1fus\n",
+                          phase.name, phase.p50Us, phase.p99Us, phase.maxUs);
+            text += line;
+        }
+        profileText.setString(text);
+        profiler.resetStats();
+    }
+
     void update(float deltaTime) {
+        SteadyClock::time_point start = SteadyClock::now();
         gameState->update(deltaTime);
+        tickTimes.add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+            SteadyClock::now() - start).count()));
+
+        // Summarizing walks the whole histogram, so only do it now and then
+        if (tickTimes.count() % STATS_TICKS == 0) {
+            tickStats = FrameStats::summarize(tickTimes);
+        }
     }
 
-    void render() {
-        window.clear(sf::Color::Black);
-        
-        // Draw game objects
-        gameState->draw(window);
-        
-        // Draw UI
+    // Game objects are already drawn; add the UI and present
+    void render(int gameDrawCalls, int hudRebuilds, const FrameStats& ticks) {
+        // Count our own text as one more call
+        int drawCalls = gameDrawCalls + 1;
+        bool statsDue = statsRefresh.getElapsedTime().asSeconds() >= PROFILE_REFRESH_SECONDS;
+        if (drawCalls != shownDrawCalls || hudRebuilds != shownHudRebuilds || statsDue) {
+            shownDrawCalls = drawCalls;
+            shownHudRebuilds = hudRebuilds;
+            if (statsDue) {
+                statsRefresh.restart();
+                shownTickStats = ticks;
+            }
+            FrameStats frames = FrameStats::summarize(frameTimes);
+            char line[192];
+            std::snprintf(line, sizeof(line),
+                          "Draw calls: %d  HUD rebuilds: %d  Frame p50/p99/max %.1f/%.1f/%.1f ms"
+                          "  Tick %.2f/%.2f/%.2f ms", drawCalls, hudRebuilds, frames.p50Ms,
+                          frames.p99Ms, frames.maxMs, shownTickStats.p50Ms, shownTickStats.p99Ms,
+                          shownTickStats.maxMs);
+            debugText.setString(line);
+        }
         window.draw(debugText);
+
+        if (showProfile) {
+            if (profileRefresh.getElapsedTime().asSeconds() >= PROFILE_REFRESH_SECONDS) {
+                refreshProfileText();
+            }
+            window.draw(profileText);
+        }
         
+        PROFILE_SCOPE("window.display");
         window.display();
     }
+
+    void printFrameStats() const {
+        FrameStats frames = FrameStats::summarize(frameTimes);
+        FrameStats ticks = FrameStats::summarize(tickTimes);
+        std::printf("%s mode\n"
+                    "  frames: %llu  p50 %.2f ms  p99 %.2f ms  max %.2f ms\n"
+                    "  ticks:  %llu  p50 %.3f ms  p99 %.3f ms  max %.3f ms\n",
+                    threaded ? "Two-thread" : "Single-thread",
+                    static_cast<unsigned long long>(frames.count), frames.p50Ms, frames.p99Ms,
+                    frames.maxMs, static_cast<unsigned long long>(ticks.count), ticks.p50Ms,
+                    ticks.p99Ms, ticks.maxMs);
+    }
 };
 
-int main() {
+int main(int argc, char* argv[]) {
+    WorldConfig world;
+    std::string tickRate;
+    int maxCatchUpSteps = MAX_CATCH_UP_STEPS;
+    std::string recordPath;
+    bool threaded = false;
+    bool windowed = false;
+
     try {
-        Game game;
+        for (int i = 1; i < argc; ++i) {
+            bool hasValue = i + 1 < argc;
+            if (std::strcmp(argv[i], "--tick-rate") == 0 && hasValue) {
+                tickRate = argv[++i];
+            } else if (std::strcmp(argv[i], "--max-catch-up") == 0 && hasValue) {
+                maxCatchUpSteps = std::atoi(argv[++i]);
+            } else if (std::strcmp(argv[i], "--record") == 0 && hasValue) {
+                recordPath = argv[++i];
+            } else if (std::strcmp(argv[i], "--threaded") == 0) {
+                threaded = true;
+            } else if (std::strcmp(argv[i], "--windowed") == 0) {
+                windowed = true;
+            } else if (!WorldConfig::parseArgument(argc, argv, i, world)) {
+                std::cerr << "Usage: " << argv[0] << " [--tick-rate HZ] [--max-catch-up STEPS]"
+                          << " [--record FILE] [--threaded] [--windowed]\n       "
+                          << WorldConfig::usage() << std::endl;
+                return 1;
+            }
+        }
+        // After the loop, so a --preset or --config anywhere can't undo it
+        if (!tickRate.empty()) {
+            world.set("tick_rate", tickRate);
+        }
+        world.validate();
+
+        Game game(world, maxCatchUpSteps, recordPath, threaded, windowed);
         game.run();
     } catch (const std::exception& e) {
         std::cerr << "Error: " << e.what() << std::endl;
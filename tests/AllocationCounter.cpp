@@ -0,0 +1,31 @@
+// tests/AllocationCounter.cpp
+#include "AllocationCounter.hpp"
+#include <cstdlib>
+#include <new>
+
+namespace {
+thread_local bool trackAllocations = false;
+thread_local size_t allocationCount = 0;
+} // namespace
+
+AllocationCounter::AllocationCounter() {
+    allocationCount = 0;
+    trackAllocations = true;
+}
+
+AllocationCounter::~AllocationCounter() {
+    trackAllocations = false;
+}
+
+size_t AllocationCounter::count() const {
+    return allocationCount;
+}
+
+void* operator new(std::size_t size) {
+    if (trackAllocations) ++allocationCount;
+    if (void* p = std::malloc(size ? size : 1)) return p;
+    throw std::bad_alloc();
+}
+
+void operator delete(void* p) noexcept { std::free(p); }
+void operator delete(void* p, std::size_t) noexcept { std::free(p); }
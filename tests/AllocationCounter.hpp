@@ -0,0 +1,17 @@
+// tests/AllocationCounter.hpp
+#pragma once
+#include <cstddef>
+
+// Counts global heap allocations made by this thread while it is alive.
+// The test binary's replacement operator new, in AllocationCounter.cpp,
+// does the counting.
+class AllocationCounter {
+public:
+    AllocationCounter();
+    ~AllocationCounter();
+
+    AllocationCounter(const AllocationCounter&) = delete;
+    AllocationCounter& operator=(const AllocationCounter&) = delete;
+
+    size_t count() const;
+};
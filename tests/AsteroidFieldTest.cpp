@@ -0,0 +1,66 @@
+// tests/AsteroidFieldTest.cpp
+#include <gtest/gtest.h>
+#include "AsteroidField.hpp"
+
+class AsteroidFieldTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (int i = 0; i < 3; ++i) {
+            auto asteroid = std::make_unique<Asteroid>(static_cast<Asteroid::Size>(i));
+            asteroid->setPosition(sf::Vector2f(100.0f + i * 50.0f, 200.0f));
+            asteroid->setVelocity(sf::Vector2f(30.0f, -20.0f * i));
+            field.add(*asteroid);
+            objects.push_back(std::move(asteroid));
+        }
+    }
+
+    AsteroidField field;
+    std::vector<std::unique_ptr<Asteroid>> objects;
+};
+
+TEST_F(AsteroidFieldTest, CopiesAsteroidState) {
+    ASSERT_EQ(field.size(), objects.size());
+    for (size_t i = 0; i < objects.size(); ++i) {
+        EXPECT_EQ(field.getPosition(i), objects[i]->getPosition());
+        EXPECT_EQ(field.getVelocity(i), objects[i]->getVelocity());
+        EXPECT_EQ(field.getRadius(i), objects[i]->getRadius());
+        EXPECT_EQ(field.getSize(i), objects[i]->getSize());
+        EXPECT_EQ(field.getRotationSpeed(i), objects[i]->getRotationSpeed());
+    }
+}
+
+TEST_F(AsteroidFieldTest, UpdateMatchesObjectUpdate) {
+    // Push one asteroid over the left edge to exercise wrapping
+    objects[0]->setVelocity(sf::Vector2f(-400.0f, 0.0f));
+    field.setVelocity(0, objects[0]->getVelocity());
+
+    for (int tick = 0; tick < 120; ++tick) {
+        field.update(0.016f);
+        for (auto& asteroid : objects) {
+            asteroid->update(0.016f);
+        }
+    }
+
+    for (size_t i = 0; i < objects.size(); ++i) {
+        EXPECT_FLOAT_EQ(field.getPosition(i).x, objects[i]->getPosition().x);
+        EXPECT_FLOAT_EQ(field.getPosition(i).y, objects[i]->getPosition().y);
+        EXPECT_FLOAT_EQ(field.getRotation(i), objects[i]->getRotation());
+    }
+}
+
+TEST_F(AsteroidFieldTest, WrapsAtWorldEdges) {
+    field.setPosition(0, sf::Vector2f(-1.0f, WINDOW_HEIGHT + 1.0f));
+    field.setVelocity(0, sf::Vector2f(0.0f, 0.0f));
+    field.update(0.016f);
+
+    EXPECT_EQ(field.getPosition(0), sf::Vector2f(WINDOW_WIDTH, 0.0f));
+}
+
+TEST_F(AsteroidFieldTest, RemoveSwapMovesLastIntoHole) {
+    field.removeSwap(0);
+
+    ASSERT_EQ(field.size(), 2u);
+    EXPECT_EQ(field.getPosition(0), objects[2]->getPosition());
+    EXPECT_EQ(field.getSize(0), objects[2]->getSize());
+    EXPECT_EQ(field.getPosition(1), objects[1]->getPosition());
+}
@@ -1,5 +1,7 @@
 // tests/AsteroidTest.cpp
 #include <gtest/gtest.h>
+#include <cmath>
+#include <set>
 #include "Asteroid.hpp"
 
 class AsteroidTest : public ::testing::Test {
@@ -55,3 +57,33 @@ TEST_F(AsteroidTest, ScreenWrapping) {
     largeAsteroid->update(0.016f);
     EXPECT_LT(largeAsteroid->getPosition().y, WINDOW_HEIGHT);
 }
+
+TEST_F(AsteroidTest, ShapesComeFromSharedTemplates) {
+    Random rng(12);
+    std::set<const Asteroid::Shape*> shapes;
+    for (int i = 0; i < 500; ++i) {
+        Asteroid asteroid(Asteroid::Size::Large, rng);
+        ASSERT_LT(asteroid.getShapeIndex(), Asteroid::SHAPES_PER_SIZE);
+        EXPECT_EQ(&asteroid.getShape(), &Asteroid::getShape(Asteroid::Size::Large, asteroid.getShapeIndex()));
+        shapes.insert(&asteroid.getShape());
+    }
+    EXPECT_EQ(shapes.size(), static_cast<size_t>(Asteroid::SHAPES_PER_SIZE));
+}
+
+TEST_F(AsteroidTest, TemplatesMatchSize) {
+    const std::pair<Asteroid::Size, size_t> ranges[] = {
+        {Asteroid::Size::Small, 6}, {Asteroid::Size::Medium, 8}, {Asteroid::Size::Large, 10}
+    };
+    for (const auto& [size, minPoints] : ranges) {
+        for (uint16_t i = 0; i < Asteroid::SHAPES_PER_SIZE; ++i) {
+            const Asteroid::Shape& shape = Asteroid::getShape(size, i);
+            EXPECT_GE(shape.pointCount, minPoints);
+            EXPECT_LE(shape.pointCount, minPoints + 2);
+            for (size_t p = 0; p < shape.pointCount; ++p) {
+                float r = std::hypot(shape.points[p].x, shape.points[p].y);
+                EXPECT_GE(r, Asteroid::getRadius(size) * 0.8f * ASTEROID_SCALE - 1e-3f);
+                EXPECT_LE(r, Asteroid::getRadius(size) * 1.2f * ASTEROID_SCALE + 1e-3f);
+            }
+        }
+    }
+}
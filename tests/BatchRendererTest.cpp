@@ -0,0 +1,89 @@
+// tests/BatchRendererTest.cpp
+#include <gtest/gtest.h>
+#include <algorithm>
+#include "BatchRenderer.hpp"
+#include "GameState.hpp"
+
+TEST(BatchRendererTest, OutlineEmitsOneSegmentPerEdge) {
+    RenderCommandList commands;
+    BatchRenderer batch;
+    sf::RenderWindow window;
+
+    sf::Vector2f square[] = {{-1, -1}, {1, -1}, {1, 1}, {-1, 1}};
+    commands.addOutline(square, 4, sf::Vector2f(10, 10), 0.0f, sf::Color::White);
+    batch.submit(commands, window);
+
+    EXPECT_EQ(batch.getVertexCount(), 8u);
+}
+
+TEST(BatchRendererTest, SubmitIssuesOneCallPerMaterial) {
+    RenderCommandList commands;
+    BatchRenderer batch;
+    sf::RenderWindow window;
+
+    sf::Vector2f triangle[] = {{0, -1}, {-1, 1}, {1, 1}};
+    for (int i = 0; i < 100; ++i) {
+        commands.addOutline(triangle, 3, sf::Vector2f(i, i), i * 3.0f, sf::Color::White);
+        commands.addCircle(sf::Vector2f(i, 0), 2.0f, sf::Color::White);
+    }
+    batch.submit(commands, window);
+    EXPECT_EQ(batch.getDrawCalls(), 2);
+    EXPECT_EQ(batch.getVertexCount(), 100u * (6 + 3 * BatchRenderer::CIRCLE_SEGMENTS));
+
+    // Nothing queued means nothing drawn
+    commands.clear();
+    batch.submit(commands, window);
+    EXPECT_EQ(batch.getDrawCalls(), 0);
+}
+
+TEST(BatchRendererTest, TextIsLaidOutOnlyWhenItChanges) {
+    RenderCommandList commands;
+    BatchRenderer batch;
+    sf::RenderWindow window;
+    sf::Font font;
+    batch.setFont(font);
+
+    auto frame = [&](const char* score) {
+        commands.clear();
+        commands.addText(score, sf::Vector2f(10, 10), 20, sf::Color::White);
+        commands.addText("Banner", sf::Vector2f(400, 300), 32, sf::Color::White, true);
+        batch.submit(commands, window);
+    };
+
+    frame("Score: 0");
+    EXPECT_EQ(batch.getTextRebuilds(), 2);
+    EXPECT_EQ(batch.getDrawCalls(), 2);
+
+    frame("Score: 0");
+    EXPECT_EQ(batch.getTextRebuilds(), 0);
+
+    frame("Score: 20");
+    EXPECT_EQ(batch.getTextRebuilds(), 1);
+}
+
+TEST(BatchRendererTest, TextIsSkippedWithoutFont) {
+    RenderCommandList commands;
+    BatchRenderer batch;
+    sf::RenderWindow window;
+
+    commands.addText("Score: 0", sf::Vector2f(10, 10), 20, sf::Color::White);
+    batch.submit(commands, window);
+    EXPECT_EQ(batch.getDrawCalls(), 0);
+}
+
+TEST(BatchRendererTest, GameStateBatchesAllEntities) {
+    GameState gameState;
+    sf::RenderWindow window;
+    gameState.update(0.016f);
+
+    // Ship and asteroids share the outline batch. HUD texts add one call
+    // each, but only when a font was found, so count them apart.
+    gameState.draw(window, 1.0f);
+    RenderCommandList commands;
+    gameState.draw(commands, 1.0f);
+    const auto texts = std::count_if(commands.commands().begin(), commands.commands().end(),
+        [](const RenderCommandList::Command& c) { return c.kind == RenderCommandList::Kind::Text; });
+    EXPECT_GT(texts, 0);
+    const int textCalls = gameState.getFont() ? static_cast<int>(texts) : 0;
+    EXPECT_EQ(gameState.getDrawCalls() - textCalls, 1);
+}
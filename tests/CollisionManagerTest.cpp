@@ -0,0 +1,123 @@
+// tests/CollisionManagerTest.cpp
+#include <gtest/gtest.h>
+#include "CollisionManager.hpp"
+
+class CollisionManagerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        asteroid = std::make_unique<Asteroid>(Asteroid::Size::Small);
+        asteroid->setPosition(sf::Vector2f(WINDOW_WIDTH/2, WINDOW_HEIGHT/2));
+    }
+
+    std::unique_ptr<Asteroid> asteroid;
+};
+
+TEST_F(CollisionManagerTest, BulletInsideAsteroid) {
+    Bullet bullet(asteroid->getPosition() + sf::Vector2f(5, 0), 0.0f);
+    EXPECT_TRUE(CollisionManager::checkCollision(bullet, *asteroid));
+}
+
+TEST_F(CollisionManagerTest, BulletOutsideAsteroid) {
+    float gap = asteroid->getRadius() + 2.0f + 1.0f;
+    Bullet bullet(asteroid->getPosition() + sf::Vector2f(gap, 0), 0.0f);
+    EXPECT_FALSE(CollisionManager::checkCollision(bullet, *asteroid));
+}
+
+TEST_F(CollisionManagerTest, ShipCollidesAcrossScreenEdge) {
+    Ship ship;
+    ship.setPosition(sf::Vector2f(2, WINDOW_HEIGHT/2));
+    asteroid->setPosition(sf::Vector2f(WINDOW_WIDTH - 2, WINDOW_HEIGHT/2));
+    EXPECT_TRUE(CollisionManager::checkCollision(ship, *asteroid));
+
+    ship.setPosition(sf::Vector2f(WINDOW_WIDTH/2, WINDOW_HEIGHT - 1));
+    asteroid->setPosition(sf::Vector2f(WINDOW_WIDTH/2, 1));
+    EXPECT_TRUE(CollisionManager::checkCollision(ship, *asteroid));
+}
+
+TEST_F(CollisionManagerTest, WrappedDeltaTakesShortestPath) {
+    sf::Vector2f world(100, 50);
+    sf::Vector2f delta = CollisionManager::wrappedDelta(sf::Vector2f(95, 5), sf::Vector2f(5, 45), world);
+    EXPECT_FLOAT_EQ(delta.x, 10.0f);
+    EXPECT_FLOAT_EQ(delta.y, -10.0f);
+    EXPECT_FLOAT_EQ(CollisionManager::getDistanceSquared(sf::Vector2f(95, 5), sf::Vector2f(5, 45), world), 200.0f);
+}
+
+TEST_F(CollisionManagerTest, TouchingCirclesDoNotOverlap) {
+    sf::Vector2f world(1000, 1000);
+    EXPECT_FALSE(CollisionManager::circlesOverlap(sf::Vector2f(0, 0), 3.0f, sf::Vector2f(5, 0), 2.0f, world));
+    EXPECT_TRUE(CollisionManager::circlesOverlap(sf::Vector2f(0, 0), 3.0f, sf::Vector2f(4.9f, 0), 2.0f, world));
+}
+
+TEST_F(CollisionManagerTest, SweptBulletCannotSkipSmallAsteroid) {
+    // 500 px/s at 10 Hz is a 50 px step, twice the 24 px contact diameter
+    Bullet bullet(asteroid->getPosition() - sf::Vector2f(30, 0), 90.0f);
+    bullet.update(0.1f);
+    ASSERT_FALSE(CollisionManager::checkCollision(bullet, *asteroid));
+
+    float timeOfImpact = -1.0f;
+    ASSERT_TRUE(CollisionManager::sweep(bullet, *asteroid, timeOfImpact));
+    EXPECT_NEAR(timeOfImpact, (30.0f - 12.0f) / 50.0f, 1e-3f);
+}
+
+TEST_F(CollisionManagerTest, SweptBulletsHitAtLowTickRates) {
+    const float tickRates[] = {60.0f, 30.0f, 15.0f, 10.0f, 5.0f};
+    const float contact = asteroid->getRadius() + 2.0f;
+
+    for (float tickRate : tickRates) {
+        for (float lateral : {-contact + 0.5f, 0.0f, contact - 0.5f, contact + 0.5f}) {
+            Bullet bullet(asteroid->getPosition() - sf::Vector2f(200, lateral), 90.0f);
+            bool hit = false;
+            float timeOfImpact;
+            while (!hit && !bullet.hasExpired()) {
+                bullet.update(1.0f / tickRate);
+                hit = CollisionManager::sweep(bullet, *asteroid, timeOfImpact);
+            }
+            EXPECT_EQ(hit, std::abs(lateral) < contact)
+                << "tick rate " << tickRate << ", lateral offset " << lateral;
+        }
+    }
+}
+
+TEST_F(CollisionManagerTest, SweptShipHitsAsteroidItPassesThrough) {
+    Ship ship;
+    ship.setPosition(asteroid->getPosition() - sf::Vector2f(100, 0));
+    ship.setVelocity(sf::Vector2f(SHIP_MAX_SPEED, 0));
+    ship.update(0.5f);
+    ASSERT_FALSE(CollisionManager::checkCollision(ship, *asteroid));
+
+    float timeOfImpact;
+    EXPECT_TRUE(CollisionManager::sweep(ship, *asteroid, timeOfImpact));
+}
+
+TEST_F(CollisionManagerTest, SweptCirclesAccountForBothMotions) {
+    sf::Vector2f world(1000, 1000);
+    float timeOfImpact = -1.0f;
+
+    // Head on: gap of 20 closes at 40 per tick
+    EXPECT_TRUE(CollisionManager::sweptCirclesHit(sf::Vector2f(100, 100), sf::Vector2f(20, 0), 5.0f,
+                                                  sf::Vector2f(130, 100), sf::Vector2f(-20, 0), 5.0f,
+                                                  world, timeOfImpact));
+    EXPECT_NEAR(timeOfImpact, 0.5f, 1e-5f);
+
+    // Same speed, same direction: never closes
+    EXPECT_FALSE(CollisionManager::sweptCirclesHit(sf::Vector2f(100, 100), sf::Vector2f(20, 0), 5.0f,
+                                                   sf::Vector2f(130, 100), sf::Vector2f(20, 0), 5.0f,
+                                                   world, timeOfImpact));
+
+    // Moving apart from a near miss
+    EXPECT_FALSE(CollisionManager::sweptCirclesHit(sf::Vector2f(100, 100), sf::Vector2f(-50, 0), 5.0f,
+                                                   sf::Vector2f(111, 100), sf::Vector2f(0, 0), 5.0f,
+                                                   world, timeOfImpact));
+
+    // Already overlapping at the start of the tick
+    EXPECT_TRUE(CollisionManager::sweptCirclesHit(sf::Vector2f(100, 100), sf::Vector2f(0, 0), 5.0f,
+                                                  sf::Vector2f(105, 100), sf::Vector2f(0, 0), 5.0f,
+                                                  world, timeOfImpact));
+    EXPECT_FLOAT_EQ(timeOfImpact, 0.0f);
+
+    // Across the wrap seam
+    EXPECT_TRUE(CollisionManager::sweptCirclesHit(sf::Vector2f(980, 500), sf::Vector2f(40, 0), 5.0f,
+                                                  sf::Vector2f(20, 500), sf::Vector2f(0, 0), 5.0f,
+                                                  world, timeOfImpact));
+    EXPECT_NEAR(timeOfImpact, 0.75f, 1e-4f);
+}
@@ -0,0 +1,71 @@
+// tests/DebugUtilsTest.cpp
+#include <gtest/gtest.h>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "DebugUtils.hpp"
+
+namespace {
+
+// Count log lines containing the given tag
+size_t countLines(const std::string& tag) {
+    std::ifstream file("game_debug.log");
+    std::string line;
+    size_t count = 0;
+    while (std::getline(file, line)) {
+        if (line.find(tag) != std::string::npos) ++count;
+    }
+    return count;
+}
+
+} // namespace
+
+TEST(DebugUtilsTest, DisabledMacrosDoNotEvaluateArguments) {
+#if ASTEROIDS_LOG_LEVEL < ASTEROIDS_LOG_LEVEL_TRACE
+    int calls = 0;
+    auto expensive = [&calls]() { ++calls; return std::string("expensive"); };
+    LOG_TRACE(expensive());
+    GOT_HERE();
+    EXPECT_EQ(calls, 0);
+#else
+    GTEST_SKIP() << "Trace logging is compiled in";
+#endif
+}
+
+TEST(DebugUtilsTest, WritesMessagesAndValues) {
+    // The log file is appended to across runs, so compare before and after
+    size_t messagesBefore = countLines("debug-utils-test message");
+    size_t valuesBefore = countLines("debug-utils-test value: 42");
+
+    GameLogger& logger = GameLogger::instance();
+    logger.log(GameLogger::Level::Error, "debug-utils-test message");
+    logger.logValue(GameLogger::Level::Error, "debug-utils-test value", 42);
+    logger.flush();
+
+    EXPECT_EQ(countLines("debug-utils-test message"), messagesBefore + 1);
+    EXPECT_EQ(countLines("debug-utils-test value: 42"), valuesBefore + 1);
+}
+
+TEST(DebugUtilsTest, ConcurrentProducersLoseNothingButDrops) {
+    GameLogger& logger = GameLogger::instance();
+    uint64_t droppedBefore = logger.droppedCount();
+    size_t linesBefore = countLines("debug-utils-test thread");
+
+    const int threads = 4;
+    const int perThread = 500;
+    std::vector<std::thread> workers;
+    for (int t = 0; t < threads; ++t) {
+        workers.emplace_back([&logger]() {
+            for (int i = 0; i < perThread; ++i) {
+                logger.logValue(GameLogger::Level::Info, "debug-utils-test thread", i);
+            }
+        });
+    }
+    for (auto& worker : workers) worker.join();
+    logger.flush();
+
+    size_t written = countLines("debug-utils-test thread") - linesBefore;
+    uint64_t dropped = logger.droppedCount() - droppedBefore;
+    EXPECT_EQ(written + dropped, static_cast<size_t>(threads * perThread));
+}
@@ -0,0 +1,90 @@
+// tests/EntityStoreTest.cpp
+#include <gtest/gtest.h>
+#include <vector>
+#include "Asteroid.hpp"
+#include "Bullet.hpp"
+#include "EntityStore.hpp"
+#include "GameObjectManager.hpp"
+
+class EntityStoreTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (int i = 0; i < 6; ++i) {
+            store.spawn(sf::Vector2f(10.0f * i, 0.0f), 90.0f);
+        }
+    }
+
+    std::vector<float> positionsX() const {
+        std::vector<float> xs;
+        for (const Bullet& bullet : store) {
+            xs.push_back(bullet.getPosition().x);
+        }
+        return xs;
+    }
+
+    EntityStore<Bullet> store;
+};
+
+TEST_F(EntityStoreTest, CompactIsStable) {
+    store.markForRemoval(0);
+    store.markForRemoval(3);
+    store.markForRemoval(3);  // Marking twice is harmless
+    EXPECT_EQ(store.size(), 6u);
+    EXPECT_TRUE(store.isMarkedForRemoval(3));
+
+    store.compact();
+    EXPECT_EQ(positionsX(), (std::vector<float>{10.0f, 20.0f, 40.0f, 50.0f}));
+    EXPECT_EQ(store.markedForRemoval(), 0u);
+    EXPECT_FALSE(store.isMarkedForRemoval(0));
+}
+
+TEST_F(EntityStoreTest, UpdateDropsMarkedThenSteps) {
+    store.markForRemoval(5);
+    store.update(0.1f);
+
+    ASSERT_EQ(store.size(), 5u);
+    for (const Bullet& bullet : store) {
+        EXPECT_NEAR(bullet.getPosition().x - bullet.getPreviousPosition().x, 50.0f, 1e-3f);
+    }
+}
+
+TEST_F(EntityStoreTest, RemoveIfKeepsOrder) {
+    store.markForRemoval(1);
+    store.removeIf([](const Bullet& bullet) { return bullet.getPosition().x > 35.0f; });
+    EXPECT_EQ(positionsX(), (std::vector<float>{0.0f, 20.0f, 30.0f}));
+
+    // Flags still line up with the survivors
+    store.markForRemoval(2);
+    store.compact();
+    EXPECT_EQ(positionsX(), (std::vector<float>{0.0f, 20.0f}));
+}
+
+// The by-value path must step entities exactly like the pooled one
+TEST(EntityStoreParityTest, MatchesGameObjectManager) {
+    Random storeRng(8), managerRng(8);
+    EntityStore<Asteroid> store;
+    GameObjectManager<Asteroid> manager;
+    for (int i = 0; i < 50; ++i) {
+        sf::Vector2f position(16.0f * i, 12.0f * i);
+        sf::Vector2f velocity(3.0f * i - 70.0f, 90.0f - 4.0f * i);
+        Asteroid& stored = store.spawn(Asteroid::Size::Medium, storeRng);
+        Asteroid* managed = manager.spawn(Asteroid::Size::Medium, managerRng);
+        stored.setPosition(position);
+        stored.setVelocity(velocity);
+        managed->setPosition(position);
+        managed->setVelocity(velocity);
+    }
+
+    for (int tick = 0; tick < 100; ++tick) {
+        store.update(1.0f / 30.0f);
+        manager.update(1.0f / 30.0f);
+    }
+
+    const auto& managed = manager.getObjects();
+    ASSERT_EQ(store.size(), managed.size());
+    for (size_t i = 0; i < store.size(); ++i) {
+        EXPECT_EQ(store[i].getPosition(), managed[i]->getPosition());
+        EXPECT_EQ(store[i].getRotation(), managed[i]->getRotation());
+        EXPECT_EQ(store[i].getShapeIndex(), managed[i]->getShapeIndex());
+    }
+}
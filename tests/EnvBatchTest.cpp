@@ -0,0 +1,224 @@
+// tests/EnvBatchTest.cpp
+#include <gtest/gtest.h>
+#include <cstring>
+#include <vector>
+#include "AllocationCounter.hpp"
+#include "AsteroidsEnv.h"
+#include "EnvBatch.hpp"
+#include "Random.hpp"
+
+namespace {
+// The ship faces up at (790, 300); one asteroid sits 120 px to its right,
+// across the wrap, and the rest are parked out of sensor range
+void arrangeWrappedNeighbour(GameState& world) {
+    world.update(0.0f);  // Activate the freshly spawned field
+    Ship::State pose = world.getShip()->getState();
+    pose.body = {sf::Vector2f(790, 300), sf::Vector2f(790, 300), sf::Vector2f(0, 0)};
+    pose.rotation = pose.previousRotation = 0.0f;
+    world.getShip()->setState(pose);
+
+    const auto& asteroids = world.getAsteroids();
+    for (const auto& asteroid : asteroids) {
+        asteroid->setPosition(sf::Vector2f(400, 0));
+        asteroid->setVelocity(sf::Vector2f(0, 0));
+    }
+    asteroids[0]->setPosition(sf::Vector2f(110, 300));
+    asteroids[0]->setVelocity(sf::Vector2f(0, 10));
+}
+} // namespace
+
+TEST(EnvBatchTest, ObservesShipNeighboursAndRays) {
+    EnvBatch envs(2, EnvBatch::Options{});
+    const size_t stride = envs.observationSize();
+    ASSERT_EQ(stride, EnvBatch::SHIP_FEATURES + 8 * EnvBatch::ASTEROID_FEATURES + 16);
+
+    // Fresh worlds: ship centred, facing up, at rest
+    const float* row = envs.observations() + stride;
+    EXPECT_FLOAT_EQ(row[0], 0.5f);
+    EXPECT_FLOAT_EQ(row[1], 0.5f);
+    EXPECT_FLOAT_EQ(row[2], 0.0f);
+    EXPECT_NEAR(row[4], 0.0f, 1e-6f);
+    EXPECT_FLOAT_EQ(row[5], -1.0f);
+    // The field is still pending its first update but already observed
+    EXPECT_FLOAT_EQ(row[EnvBatch::SHIP_FEATURES], 1.0f);
+
+    arrangeWrappedNeighbour(envs.getWorld(1));
+    envs.observe();
+    row = envs.observations() + stride;
+    const float radius = Asteroid::getRadius(Asteroid::Size::Large);
+
+    const float* nearest = row + EnvBatch::SHIP_FEATURES;
+    EXPECT_FLOAT_EQ(nearest[0], 1.0f);
+    EXPECT_FLOAT_EQ(nearest[1], 120.0f / 400.0f);  // Not -680 the long way round
+    EXPECT_FLOAT_EQ(nearest[2], 0.0f);
+    EXPECT_FLOAT_EQ(nearest[4], 10.0f / SHIP_MAX_SPEED);
+    EXPECT_FLOAT_EQ(nearest[5], 1.0f);
+    // Four asteroids in the classic world, so the last four slots are empty
+    for (size_t i = INITIAL_ASTEROID_COUNT * EnvBatch::ASTEROID_FEATURES;
+         i < 8 * EnvBatch::ASTEROID_FEATURES; ++i) {
+        EXPECT_EQ(nearest[i], 0.0f) << i;
+    }
+
+    // Ray 4 of 16 points a quarter turn clockwise from up: straight right
+    const float* rays = nearest + 8 * EnvBatch::ASTEROID_FEATURES;
+    EXPECT_NEAR(rays[4], (120.0f - radius) / 400.0f, 1e-5f);
+    EXPECT_FLOAT_EQ(rays[0], 1.0f);
+    EXPECT_FLOAT_EQ(rays[12], 1.0f);
+
+    // The other environment is untouched
+    EXPECT_FLOAT_EQ(envs.observations()[0], 0.5f);
+}
+
+// The default range reaches past half the classic height, so a ray can
+// meet an asteroid's far copy when its nearest one lies the other way
+TEST(EnvBatchTest, RaysSeeFarWrappedCopies) {
+    EnvBatch envs(1, EnvBatch::Options{});
+    GameState& world = envs.getWorld(0);
+    world.update(0.0f);
+    Ship::State pose = world.getShip()->getState();
+    pose.body = {sf::Vector2f(400, 300), sf::Vector2f(400, 300), sf::Vector2f(0, 0)};
+    pose.rotation = pose.previousRotation = 0.0f;
+    world.getShip()->setState(pose);
+    for (const auto& asteroid : world.getAsteroids()) {
+        asteroid->setPosition(sf::Vector2f(0, 150));  // Out of every ray's reach
+    }
+    world.getAsteroids()[0]->setPosition(sf::Vector2f(400, 5));
+    envs.observe();
+
+    const float radius = Asteroid::getRadius(Asteroid::Size::Large);
+    const float* rays = envs.observations() + EnvBatch::SHIP_FEATURES + 8 * EnvBatch::ASTEROID_FEATURES;
+    EXPECT_NEAR(rays[0], (295.0f - radius) / 400.0f, 1e-5f);  // Up, the nearest copy
+    EXPECT_NEAR(rays[8], (305.0f - radius) / 400.0f, 1e-5f);  // Down, across the wrap
+    EXPECT_FLOAT_EQ(rays[4], 1.0f);
+}
+
+TEST(EnvBatchTest, RewardsPointsAndResetsWhenDone) {
+    EnvBatch envs(1, EnvBatch::Options{});
+    GameState& world = envs.getWorld(0);
+    arrangeWrappedNeighbour(world);
+    // Move the neighbour into the line of fire, straight up
+    world.getAsteroids()[0]->setPosition(sf::Vector2f(790, 150));
+    world.getAsteroids()[0]->setVelocity(sf::Vector2f(0, 0));
+
+    const uint8_t fire = EnvBatch::FIRE;
+    float total = 0.0f;
+    for (int step = 0; step < 60 && total == 0.0f; ++step) {
+        envs.step(&fire);
+        total += envs.rewards()[0];
+        ASSERT_EQ(envs.dones()[0], 0);
+    }
+    EXPECT_EQ(total, static_cast<float>(POINTS_LARGE_ASTEROID));
+    EXPECT_EQ(world.getScore(), POINTS_LARGE_ASTEROID);
+
+    // Ram a split piece: the episode ends and the next one begins
+    world.getAsteroids()[0]->setPosition(world.getShip()->getPosition());
+    const uint8_t idle = 0;
+    envs.step(&idle);
+    EXPECT_EQ(envs.dones()[0], 1);
+    EXPECT_EQ(envs.rewards()[0], 0.0f);
+    EXPECT_FALSE(world.isGameOver());
+    EXPECT_EQ(world.getScore(), 0);
+    EXPECT_FLOAT_EQ(envs.observations()[0], 0.5f);
+}
+
+TEST(EnvBatchTest, PooledStepsMatchSerial) {
+    EnvBatch::Options options;
+    options.seed = 77;
+    options.ticksPerStep = 2;
+    EnvBatch serial(8, options);
+    EnvBatch pooled(8, options);
+    ThreadPool pool(4);
+    const size_t values = serial.size() * serial.observationSize();
+
+    Random rng(5);
+    std::vector<uint8_t> actions(serial.size());
+    int episodesEnded = 0;
+    for (int step = 0; step < 400; ++step) {
+        for (uint8_t& action : actions) action = static_cast<uint8_t>(rng.range(0, 15));
+        serial.step(actions.data());
+        pooled.step(actions.data(), &pool);
+
+        ASSERT_EQ(std::memcmp(serial.observations(), pooled.observations(), values * sizeof(float)), 0)
+            << "step " << step;
+        ASSERT_EQ(std::memcmp(serial.rewards(), pooled.rewards(), serial.size() * sizeof(float)), 0);
+        ASSERT_EQ(std::memcmp(serial.dones(), pooled.dones(), serial.size()), 0);
+        for (size_t i = 0; i < serial.size(); ++i) episodesEnded += serial.dones()[i];
+    }
+    EXPECT_GT(episodesEnded, 0);
+}
+
+TEST(EnvBatchTest, RejectsBadOptions) {
+    EXPECT_THROW(EnvBatch(0, EnvBatch::Options{}), std::invalid_argument);
+    EnvBatch::Options options;
+    options.sensorRange = 0.0f;
+    EXPECT_THROW(EnvBatch(1, options), std::invalid_argument);
+}
+
+TEST(EnvBatchTest, CApi) {
+    AsteroidsEnv* env = asteroids_env_create(3, 9, nullptr, 2);
+    ASSERT_NE(env, nullptr) << asteroids_env_last_error();
+    ASSERT_EQ(asteroids_env_count(env), 3u);
+    const size_t stride = asteroids_env_observation_size(env);
+    EXPECT_EQ(stride, EnvBatch::SHIP_FEATURES + 8 * EnvBatch::ASTEROID_FEATURES + 16);
+
+    const uint8_t actions[3] = {ASTEROIDS_ACTION_THRUST, ASTEROIDS_ACTION_FIRE,
+                                ASTEROIDS_ACTION_ROTATE_LEFT | ASTEROIDS_ACTION_FIRE};
+    for (int step = 0; step < 30; ++step) {
+        ASSERT_EQ(asteroids_env_step(env, actions), 0) << asteroids_env_last_error();
+    }
+    // The thrusting ship has moved up from the centre
+    EXPECT_LT(asteroids_env_observations(env)[1], 0.5f);
+    EXPECT_LT(asteroids_env_observations(env)[3], 0.0f);
+    ASSERT_EQ(asteroids_env_reset(env), 0) << asteroids_env_last_error();
+    EXPECT_FLOAT_EQ(asteroids_env_observations(env)[1], 0.5f);
+    EXPECT_EQ(asteroids_env_rewards(env)[0], 0.0f);
+    EXPECT_EQ(asteroids_env_dones(env)[0], 0);
+    asteroids_env_destroy(env);
+
+    // Failures come back as statuses, never as exceptions
+    EXPECT_EQ(asteroids_env_create(1, 0, "no-such-preset", 1), nullptr);
+    EXPECT_NE(std::strlen(asteroids_env_last_error()), 0u);
+    EXPECT_EQ(asteroids_env_step(nullptr, actions), -1);
+    EXPECT_NE(std::strlen(asteroids_env_last_error()), 0u);
+    EXPECT_EQ(asteroids_env_reset(nullptr), -1);
+}
+
+TEST(EnvBatchTest, StepsDoNotAllocateAfterWarmUp) {
+    // Asteroids, fragments included, are parked before every step so no
+    // ship is hit, and there are enough of them that no field is cleared.
+    // The long warm-up lets every field pass its peak asteroid count.
+    auto config = std::make_shared<WorldConfig>();
+    config->asteroidCount = 40;
+    EnvBatch::Options options;
+    options.config = config;
+    EnvBatch envs(4, options);
+    std::vector<uint8_t> actions(envs.size());
+    auto step = [&](int i) {
+        for (size_t e = 0; e < envs.size(); ++e) {
+            for (const auto& asteroid : envs.getWorld(e).getAsteroids()) {
+                asteroid->setVelocity(sf::Vector2f(0.0f, 0.0f));
+            }
+            actions[e] = EnvBatch::ROTATE_RIGHT | (i % 8 < 4 ? EnvBatch::FIRE : 0);
+        }
+        envs.step(actions.data());
+    };
+    for (int i = 0; i < 900; ++i) step(i);
+
+    size_t allocations;
+    int episodesEnded = 0;
+    float reward = 0.0f;
+    {
+        AllocationCounter counter;
+        for (int i = 900; i < 1200; ++i) {
+            step(i);
+            for (size_t e = 0; e < envs.size(); ++e) {
+                episodesEnded += envs.dones()[e];
+                reward += envs.rewards()[e];
+            }
+        }
+        allocations = counter.count();
+    }
+    ASSERT_EQ(episodesEnded, 0);
+    EXPECT_GT(reward, 0.0f) << "No asteroids were split during the measured steps";
+    EXPECT_EQ(allocations, 0u);
+}
@@ -0,0 +1,51 @@
+// tests/FixedTimestepTest.cpp
+#include <gtest/gtest.h>
+#include "FixedTimestep.hpp"
+#include "Bullet.hpp"
+#include "Asteroid.hpp"
+
+TEST(FixedTimestepTest, AccumulatesPartialFrames) {
+    FixedTimestep timestep(100.0f, 8);
+
+    EXPECT_EQ(timestep.advance(0.004f), 0);
+    EXPECT_NEAR(timestep.getAlpha(), 0.4f, 1e-4f);
+    EXPECT_EQ(timestep.advance(0.007f), 1);
+    EXPECT_NEAR(timestep.getAlpha(), 0.1f, 1e-4f);
+}
+
+TEST(FixedTimestepTest, RunsSeveralStepsForSlowFrames) {
+    FixedTimestep timestep(120.0f, 8);
+    EXPECT_EQ(timestep.advance(3.0f / 120.0f + 0.001f), 3);
+    EXPECT_FLOAT_EQ(timestep.getStep(), 1.0f / 120.0f);
+}
+
+TEST(FixedTimestepTest, CapsCatchUpAfterHitch) {
+    FixedTimestep timestep(60.0f, 4);
+
+    // A two second stall must not queue up 120 steps
+    EXPECT_EQ(timestep.advance(2.0f), 4);
+    EXPECT_GT(timestep.getDroppedTime(), 1.9f);
+    EXPECT_EQ(timestep.advance(0.0f), 0);
+}
+
+TEST(FixedTimestepTest, InterpolatesObjectPositions) {
+    Bullet bullet(sf::Vector2f(WINDOW_WIDTH/2, WINDOW_HEIGHT/2), 90.0f);  // Moving right
+    sf::Vector2f before = bullet.getPosition();
+    bullet.update(0.01f);
+    sf::Vector2f after = bullet.getPosition();
+
+    sf::Vector2f halfway = bullet.getInterpolatedPosition(0.5f);
+    EXPECT_FLOAT_EQ(halfway.x, (before.x + after.x) / 2.0f);
+    EXPECT_EQ(bullet.getInterpolatedPosition(1.0f), after);
+    EXPECT_EQ(bullet.getInterpolatedPosition(0.0f), before);
+}
+
+TEST(FixedTimestepTest, DoesNotInterpolateAcrossWrap) {
+    Asteroid asteroid(Asteroid::Size::Small);
+    asteroid.setPosition(sf::Vector2f(WINDOW_WIDTH - 1.0f, WINDOW_HEIGHT/2));
+    asteroid.setVelocity(sf::Vector2f(100.0f, 0.0f));
+    asteroid.update(0.1f);
+
+    // Wrapped to the left edge; halfway must not be mid-screen
+    EXPECT_EQ(asteroid.getInterpolatedPosition(0.5f), asteroid.getPosition());
+}
@@ -0,0 +1,79 @@
+// tests/GameObjectManagerTest.cpp
+#include <gtest/gtest.h>
+#include <vector>
+#include "GameObjectManager.hpp"
+#include "Bullet.hpp"
+
+class GameObjectManagerTest : public ::testing::Test {
+protected:
+    void SetUp() override {
+        for (int i = 0; i < 6; ++i) {
+            manager.spawn(sf::Vector2f(10.0f * i, 0.0f), 90.0f);
+        }
+        manager.update(0.0f);
+    }
+
+    std::vector<float> positionsX() const {
+        std::vector<float> xs;
+        for (const auto& bullet : manager.getObjects()) {
+            xs.push_back(bullet->getPosition().x);
+        }
+        return xs;
+    }
+
+    GameObjectManager<Bullet> manager;
+};
+
+TEST_F(GameObjectManagerTest, MarkingDoesNotMoveObjects) {
+    const Bullet* third = manager.getObjects()[2].get();
+    manager.markForRemoval(1);
+    manager.markForRemoval(4);
+
+    EXPECT_EQ(manager.getObjects().size(), 6u);
+    EXPECT_EQ(manager.getObjects()[2].get(), third);
+    EXPECT_TRUE(manager.isMarkedForRemoval(1));
+    EXPECT_FALSE(manager.isMarkedForRemoval(2));
+    EXPECT_EQ(manager.markedForRemoval(), 2u);
+}
+
+TEST_F(GameObjectManagerTest, CompactIsStable) {
+    manager.markForRemoval(0);
+    manager.markForRemoval(3);
+    manager.markForRemoval(3);  // Marking twice is harmless
+    manager.compact();
+
+    EXPECT_EQ(positionsX(), (std::vector<float>{10.0f, 20.0f, 40.0f, 50.0f}));
+    EXPECT_EQ(manager.markedForRemoval(), 0u);
+    EXPECT_FALSE(manager.isMarkedForRemoval(0));
+}
+
+TEST_F(GameObjectManagerTest, CompactReturnsSlotsToPool) {
+    size_t capacity = manager.poolCapacity();
+    for (size_t i = 0; i < 6; ++i) {
+        manager.markForRemoval(i);
+    }
+    manager.compact();
+    EXPECT_TRUE(manager.empty());
+
+    for (int i = 0; i < 6; ++i) {
+        manager.spawn(sf::Vector2f(0.0f, 0.0f), 0.0f);
+    }
+    EXPECT_EQ(manager.poolCapacity(), capacity);
+}
+
+TEST_F(GameObjectManagerTest, UpdateAppliesPendingMarks) {
+    manager.markForRemoval(5);
+    manager.spawn(sf::Vector2f(100.0f, 0.0f), 90.0f);
+    manager.update(0.0f);
+
+    EXPECT_EQ(manager.getObjects().size(), 6u);
+    EXPECT_FLOAT_EQ(manager.getObjects().back()->getPosition().x, 100.0f);
+}
+
+TEST_F(GameObjectManagerTest, RemoveIfTakesAnyCallable) {
+    struct FarRight {
+        bool operator()(const Bullet& b) const { return b.getPosition().x > 25.0f; }
+    };
+    manager.removeIf(FarRight{});
+    EXPECT_EQ(positionsX(), (std::vector<float>{0.0f, 10.0f, 20.0f}));
+}
@@ -106,3 +106,135 @@ TEST_F(GameStateTest, Reset) {
     EXPECT_EQ(gameState->getAsteroidCount(), INITIAL_ASTEROID_COUNT);
     EXPECT_NE(gameState->getShip(), nullptr);
 }
+
+TEST_F(GameStateTest, ShipCollidesAcrossScreenEdge) {
+    gameState->update(0.0f);
+
+    Ship* ship = gameState->getShip();
+    ASSERT_NE(ship, nullptr);
+    ship->setPosition(sf::Vector2f(1.0f, WINDOW_HEIGHT / 2.0f));
+
+    // Park every asteroid just across the left/right seam from the ship
+    for (const auto& asteroid : gameState->getAsteroids()) {
+        asteroid->setPosition(sf::Vector2f(WINDOW_WIDTH - 5.0f, WINDOW_HEIGHT / 2.0f));
+        asteroid->setVelocity(sf::Vector2f(0.0f, 0.0f));
+    }
+
+    gameState->update(0.0f);
+
+    EXPECT_TRUE(gameState->isGameOver());
+}
+
+TEST_F(GameStateTest, BulletHitsAsteroidAtLargeTimestep) {
+    InputState fire;
+    fire.fire = true;
+    gameState = std::make_unique<GameState>(std::make_unique<ScriptedInput>(
+        std::vector<InputState>{InputState{}, fire}, false));
+    gameState->update(0.0f);
+
+    // Ship faces right; its bullet starts 20 px out at x = 120
+    Ship* ship = gameState->getShip();
+    ASSERT_NE(ship, nullptr);
+    Ship::State pose = ship->getState();
+    pose.body = {sf::Vector2f(100, 300), sf::Vector2f(100, 300), sf::Vector2f(0, 0)};
+    pose.rotation = pose.previousRotation = 90.0f;
+    ship->setState(pose);
+
+    // One target whose far edge the bullet's 125 px step overshoots; the rest out of the way
+    const auto& asteroids = gameState->getAsteroids();
+    for (const auto& asteroid : asteroids) {
+        asteroid->setPosition(sf::Vector2f(600, 500));
+        asteroid->setVelocity(sf::Vector2f(0, 0));
+    }
+    asteroids[0]->setPosition(sf::Vector2f(180, 300));
+
+    gameState->update(0.25f);
+
+    EXPECT_FALSE(gameState->isGameOver());
+    EXPECT_EQ(gameState->getScore(), POINTS_LARGE_ASTEROID);
+}
+
+TEST_F(GameStateTest, ScriptedRestartAfterGameOver) {
+    InputState restart;
+    restart.restart = true;
+    gameState = std::make_unique<GameState>(std::make_unique<ScriptedInput>(
+        std::vector<InputState>{InputState{}, InputState{}, restart}, false));
+
+    gameState->update(0.0f);
+    Ship* ship = gameState->getShip();
+    ASSERT_NE(ship, nullptr);
+    gameState->getAsteroids()[0]->setPosition(ship->getPosition());
+
+    gameState->update(0.016f);
+    EXPECT_TRUE(gameState->isGameOver());
+
+    // Third scripted tick presses restart
+    gameState->update(0.016f);
+    EXPECT_FALSE(gameState->isGameOver());
+    EXPECT_EQ(gameState->getAsteroidCount(), INITIAL_ASTEROID_COUNT);
+}
+
+TEST(GameStateParallelTest, PooledCollisionsMatchSerial) {
+    // Slow, long-lived bullets fired every tick keep several chunks busy,
+    // and a crowded world gives bullets shared and multiple targets. Parked
+    // asteroids (and their splits) leave the ship alive to keep firing.
+    WorldConfig config;
+    config.asteroidCount = 200;
+    config.asteroidMinSpeed = config.asteroidMaxSpeed = 0.0f;
+    config.maxBullets = 500;
+    config.bulletSpeed = 50.0f;
+    config.fireInterval = 0.01f;
+    auto shared = std::make_shared<const WorldConfig>(config);
+
+    InputState pilot;
+    pilot.fire = true;
+    pilot.rotateRight = true;
+    pilot.restart = true;
+    auto makeGame = [&] {
+        return std::make_unique<GameState>(
+            std::make_unique<ScriptedInput>(std::vector<InputState>{pilot}), 21, shared);
+    };
+    auto serial = makeGame();
+    auto pooled = makeGame();
+    ThreadPool pool(4);
+    pooled->setThreadPool(&pool);
+
+    std::vector<uint8_t> expected, actual;
+    size_t mostBullets = 0;
+    for (int tick = 0; tick < 400; ++tick) {
+        serial->update(1.0f / 30.0f);
+        pooled->update(1.0f / 30.0f);
+        serial->saveSnapshot(expected);
+        pooled->saveSnapshot(actual);
+        ASSERT_EQ(actual, expected) << "Diverged at tick " << tick;
+        if (const Ship* ship = serial->getShip()) {
+            mostBullets = std::max(mostBullets, ship->getBulletManager().count());
+        }
+    }
+    EXPECT_GT(serial->getScore(), 0);
+    EXPECT_GT(mostBullets, 64u);
+}
+
+TEST(GameStateParallelTest, PooledGridMatchesSerial) {
+    // Several thousand asteroids per chunk, so the grid is staged on the
+    // pool; the ship fires into the crowd to exercise the queries
+    auto shared = std::make_shared<const WorldConfig>(WorldConfig::preset("10k"));
+    InputState pilot;
+    pilot.fire = true;
+    pilot.rotateRight = true;
+    std::vector<InputState> script{pilot, InputState{}};
+    auto serial = std::make_unique<GameState>(std::make_unique<ScriptedInput>(script), 5, shared);
+    auto pooled = std::make_unique<GameState>(std::make_unique<ScriptedInput>(script), 5, shared);
+    ThreadPool pool(4);
+    pooled->setThreadPool(&pool);
+
+    std::vector<uint8_t> expected, actual;
+    for (int tick = 0; tick < 120; ++tick) {
+        serial->update(1.0f / 60.0f);
+        pooled->update(1.0f / 60.0f);
+        serial->saveSnapshot(expected);
+        pooled->saveSnapshot(actual);
+        ASSERT_EQ(actual, expected) << "Diverged at tick " << tick;
+    }
+    EXPECT_GT(serial->getScore(), 0);
+}
@@ -0,0 +1,54 @@
+// tests/HudTest.cpp
+#include <gtest/gtest.h>
+#include "Hud.hpp"
+
+class HudTest : public ::testing::Test {
+protected:
+    Hud hud;
+};
+
+TEST_F(HudTest, BuildsOnceThenIdles) {
+    hud.update(0, Hud::Phase::Playing);
+    EXPECT_EQ(hud.getFrameRebuilds(), 1);
+
+    for (int frame = 0; frame < 100; ++frame) {
+        hud.update(0, Hud::Phase::Playing);
+        ASSERT_EQ(hud.getFrameRebuilds(), 0);
+    }
+    EXPECT_EQ(hud.getTotalRebuilds(), 1);
+}
+
+TEST_F(HudTest, RebuildsOnlyWhatChanged) {
+    hud.update(0, Hud::Phase::Playing);
+
+    hud.update(20, Hud::Phase::Playing);
+    EXPECT_EQ(hud.getFrameRebuilds(), 1);
+
+    hud.update(20, Hud::Phase::GameOver);
+    EXPECT_EQ(hud.getFrameRebuilds(), 1);
+
+    hud.update(20, Hud::Phase::GameOver);
+    EXPECT_EQ(hud.getFrameRebuilds(), 0);
+
+    hud.update(0, Hud::Phase::Won);
+    EXPECT_EQ(hud.getFrameRebuilds(), 2);
+}
+
+TEST_F(HudTest, EmitsScoreAndBannerRuns) {
+    RenderCommandList commands;
+    hud.draw(commands);
+    EXPECT_TRUE(commands.empty());   // Nothing until the first update
+
+    hud.update(120, Hud::Phase::Playing);
+    hud.draw(commands);
+    ASSERT_EQ(commands.commands().size(), 1u);
+    EXPECT_EQ(commands.text(commands.commands()[0]), "Score: 120");
+
+    commands.clear();
+    hud.update(120, Hud::Phase::GameOver);
+    hud.draw(commands);
+    ASSERT_EQ(commands.commands().size(), 2u);
+    const RenderCommandList::Command& banner = commands.commands()[1];
+    EXPECT_EQ(commands.text(banner).substr(0, 10), "Game Over!");
+    EXPECT_TRUE(banner.centered);
+}
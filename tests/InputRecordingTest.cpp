@@ -0,0 +1,182 @@
+// tests/InputRecordingTest.cpp
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <vector>
+#include "GameState.hpp"
+#include "InputRecording.hpp"
+#include "WorldConfig.hpp"
+
+class InputRecordingTest : public ::testing::Test {
+protected:
+    void TearDown() override {
+        std::remove(path.c_str());
+    }
+
+    // Varied input: a new combination every few ticks, with long holds
+    static InputState inputForTick(uint64_t tick) {
+        uint64_t phase = (tick / 7) * 2654435761u;
+        if (tick % 5000 > 4000) phase = 0;
+        return recording::unpackInput(static_cast<uint32_t>(phase >> 11) & 31);
+    }
+
+    std::string path = (std::filesystem::temp_directory_path() / "asteroids_recording_test.bin").string();
+};
+
+TEST_F(InputRecordingTest, PackRoundTrip) {
+    for (uint32_t bits = 0; bits < 32; ++bits) {
+        EXPECT_EQ(recording::packInput(recording::unpackInput(bits)), bits);
+    }
+}
+
+TEST_F(InputRecordingTest, RecordsEveryTick) {
+    const uint64_t ticks = 20000;
+    {
+        InputRecorder recorder(path, 77, 1.0f / 120.0f, WorldConfig::defaults());
+        for (uint64_t t = 0; t < ticks; ++t) {
+            recorder.record(inputForTick(t));
+        }
+    }
+
+    InputRecording recording(path);
+    EXPECT_EQ(recording.getSeed(), 77u);
+    EXPECT_FLOAT_EQ(recording.getStepSeconds(), 1.0f / 120.0f);
+    ASSERT_EQ(recording.getTickCount(), ticks);
+    EXPECT_LT(recording.getRunCount(), ticks / 6);
+
+    ReplayInput replay(std::make_shared<InputRecording>(path));
+    for (uint64_t t = 0; t < ticks; ++t) {
+        ASSERT_EQ(recording::packInput(replay.poll()), recording::packInput(inputForTick(t)))
+            << "tick " << t;
+    }
+    EXPECT_TRUE(replay.finished());
+}
+
+TEST_F(InputRecordingTest, HeldInputIsOneRun) {
+    InputState held;
+    held.thrust = true;
+    {
+        InputRecorder recorder(path, 1, 0.01f, WorldConfig::defaults());
+        for (int t = 0; t < 100000; ++t) recorder.record(held);
+    }
+
+    InputRecording recording(path);
+    EXPECT_EQ(recording.getRunCount(), 1u);
+    EXPECT_TRUE(recording.inputAt(99999).thrust);
+    // Header, one run and a keyframe per 1024 ticks
+    EXPECT_LT(std::filesystem::file_size(path), 2048u);
+}
+
+TEST_F(InputRecordingTest, InputAtMatchesSequentialPlayback) {
+    {
+        InputRecorder recorder(path, 3, 0.01f, WorldConfig::defaults());
+        for (uint64_t t = 0; t < 50000; ++t) recorder.record(inputForTick(t));
+    }
+
+    InputRecording recording(path);
+    for (uint64_t target : {0ull, 1023ull, 1024ull, 31337ull, 49999ull, 12ull}) {
+        EXPECT_EQ(recording::packInput(recording.inputAt(target)),
+                  recording::packInput(inputForTick(target)));
+    }
+}
+
+TEST_F(InputRecordingTest, RemembersTheWorldConfig) {
+    WorldConfig world = WorldConfig::preset("10k");
+    {
+        InputRecorder recorder(path, 5, 0.01f, world);
+        recorder.record(InputState{});
+    }
+
+    InputRecording recording(path);
+    EXPECT_TRUE(recording.recordedWith(world));
+    EXPECT_FALSE(recording.recordedWith(WorldConfig::defaults()));
+    world.bulletSpeed += 0.001f;
+    EXPECT_FALSE(recording.recordedWith(world));
+}
+
+TEST_F(InputRecordingTest, ReplayReproducesSession) {
+    std::vector<InputState> script(90);
+    for (size_t i = 0; i < script.size(); ++i) {
+        script[i].rotateLeft = i < 40;
+        script[i].thrust = i % 30 < 10;
+        script[i].fire = i % 8 < 4;
+        script[i].restart = true;
+    }
+
+    const uint32_t seed = 4242;
+    const float step = 1.0f / 120.0f;
+    GameState live(std::make_unique<RecordingInput>(std::make_unique<ScriptedInput>(script),
+                                                    std::make_unique<InputRecorder>(path, seed, step,
+                                                                                    WorldConfig::defaults())),
+                   seed);
+    for (int i = 0; i < 3000; ++i) live.update(step);
+    live.setInputSource(nullptr);  // Finishes the recording
+
+    auto recording = std::make_shared<InputRecording>(path);
+    GameState replayed(std::make_unique<ReplayInput>(recording), recording->getSeed());
+    for (uint64_t i = 0; i < recording->getTickCount(); ++i) replayed.update(recording->getStepSeconds());
+
+    ASSERT_GT(live.getScore(), 0);
+    EXPECT_EQ(replayed.getScore(), live.getScore());
+    EXPECT_EQ(replayed.isGameOver(), live.isGameOver());
+    ASSERT_EQ(replayed.getAsteroids().size(), live.getAsteroids().size());
+    for (size_t i = 0; i < live.getAsteroids().size(); ++i) {
+        EXPECT_EQ(replayed.getAsteroids()[i]->getPosition(), live.getAsteroids()[i]->getPosition());
+    }
+}
+
+TEST_F(InputRecordingTest, RejectsBadFiles) {
+    EXPECT_THROW(InputRecording("/nonexistent/recording.bin"), std::runtime_error);
+
+    std::ofstream(path, std::ios::binary) << "definitely not a recording, but long enough to hold a header";
+    EXPECT_THROW(InputRecording{path}, std::runtime_error);
+}
+
+TEST_F(InputRecordingTest, RejectsInconsistentIndex) {
+    {
+        InputRecorder recorder(path, 1, 1.0f / 60.0f, WorldConfig::defaults());
+        for (uint64_t tick = 0; tick < 3000; ++tick) recorder.record(inputForTick(tick));
+    }
+    std::ifstream in(path, std::ios::binary);
+    const std::vector<char> good((std::istreambuf_iterator<char>(in)), std::istreambuf_iterator<char>());
+    in.close();
+    ASSERT_NO_THROW(InputRecording{path});
+
+    recording::Header header;
+    std::memcpy(&header, good.data(), sizeof(header));
+    const size_t keyframesAt = (sizeof(header) + header.runCount * sizeof(uint32_t) + 7) & ~size_t(7);
+
+    auto expectRejected = [&](auto&& corrupt) {
+        std::vector<char> bytes = good;
+        corrupt(bytes);
+        std::ofstream(path, std::ios::binary | std::ios::trunc).write(bytes.data(), bytes.size());
+        EXPECT_THROW(InputRecording{path}, std::runtime_error);
+    };
+    // Runs that stop short of tickCount
+    expectRejected([&](std::vector<char>& bytes) {
+        recording::Header h = header;
+        h.tickCount += 1;
+        std::memcpy(bytes.data(), &h, sizeof(h));
+    });
+    // A run count whose byte size overflows
+    expectRejected([&](std::vector<char>& bytes) {
+        recording::Header h = header;
+        h.runCount = UINT64_MAX / 2;
+        std::memcpy(bytes.data(), &h, sizeof(h));
+    });
+    // A keyframe pointing past the last run
+    expectRejected([&](std::vector<char>& bytes) {
+        recording::Keyframe k{header.runCount, 1024};
+        std::memcpy(bytes.data() + keyframesAt + sizeof(k), &k, sizeof(k));
+    });
+    // A run made longer, so its neighbours' keyframes no longer line up
+    expectRejected([&](std::vector<char>& bytes) {
+        uint32_t run;
+        std::memcpy(&run, bytes.data() + sizeof(header), sizeof(run));
+        run += 1u << recording::BUTTON_BITS;
+        std::memcpy(bytes.data() + sizeof(header), &run, sizeof(run));
+    });
+}
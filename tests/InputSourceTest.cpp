@@ -0,0 +1,30 @@
+// tests/InputSourceTest.cpp
+#include <gtest/gtest.h>
+#include "InputSource.hpp"
+
+TEST(InputSourceTest, NullInputPressesNothing) {
+    NullInput input;
+    InputState state = input.poll();
+    EXPECT_FALSE(state.rotateLeft || state.rotateRight || state.thrust || state.fire || state.restart);
+}
+
+TEST(InputSourceTest, ScriptedInputLoops) {
+    InputState fire;
+    fire.fire = true;
+    ScriptedInput input({fire, InputState{}});
+
+    EXPECT_TRUE(input.poll().fire);
+    EXPECT_FALSE(input.poll().fire);
+    EXPECT_TRUE(input.poll().fire);
+    EXPECT_FALSE(input.finished());
+}
+
+TEST(InputSourceTest, ScriptedInputStopsWithoutLoop) {
+    InputState thrust;
+    thrust.thrust = true;
+    ScriptedInput input({thrust}, false);
+
+    EXPECT_TRUE(input.poll().thrust);
+    EXPECT_TRUE(input.finished());
+    EXPECT_FALSE(input.poll().thrust);
+}
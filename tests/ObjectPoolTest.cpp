@@ -0,0 +1,83 @@
+// tests/ObjectPoolTest.cpp
+#include <gtest/gtest.h>
+#include <memory>
+#include "AllocationCounter.hpp"
+#include "GameState.hpp"
+#include "ObjectPool.hpp"
+
+TEST(ObjectPoolTest, CounterSeesHeapAllocations) {
+    AllocationCounter counter;
+    auto value = std::make_unique<int>(1);
+    EXPECT_EQ(counter.count(), 1u);
+}
+
+TEST(ObjectPoolTest, RecyclesSlots) {
+    ObjectPool<Bullet> pool(4);
+    Bullet* first = pool.create(sf::Vector2f(0, 0), 0.0f);
+    pool.destroy(first);
+    Bullet* second = pool.create(sf::Vector2f(1, 1), 0.0f);
+
+    EXPECT_EQ(first, second);
+    EXPECT_EQ(pool.size(), 1u);
+    EXPECT_EQ(pool.capacity(), 4u);
+    pool.destroy(second);
+}
+
+TEST(ObjectPoolTest, GrowsByBlocks) {
+    ObjectPool<Bullet> pool(4);
+    std::vector<Bullet*> bullets;
+    for (int i = 0; i < 9; ++i) {
+        bullets.push_back(pool.create(sf::Vector2f(0, 0), 0.0f));
+    }
+    EXPECT_EQ(pool.capacity(), 12u);
+    for (Bullet* bullet : bullets) {
+        pool.destroy(bullet);
+    }
+    EXPECT_EQ(pool.size(), 0u);
+}
+
+TEST(ObjectPoolTest, ManagerSteadyStateDoesNotAllocate) {
+    GameObjectManager<Bullet> manager;
+    auto tick = [&manager](int i) {
+        manager.spawn(sf::Vector2f(400, 300), i * 10.0f);
+        manager.update(0.016f);
+        manager.removeIf([](const Bullet& b) { return b.hasExpired(); });
+    };
+
+    for (int i = 0; i < 200; ++i) tick(i);
+
+    AllocationCounter counter;
+    for (int i = 200; i < 400; ++i) tick(i);
+    EXPECT_EQ(counter.count(), 0u);
+}
+
+TEST(ObjectPoolTest, GameTickDoesNotAllocateAfterWarmUp) {
+    // Spin and fire continuously at parked asteroids; splits of a stationary
+    // asteroid are stationary too, so the ship is never hit
+    std::vector<InputState> script(8);
+    for (size_t i = 0; i < script.size(); ++i) {
+        script[i].rotateRight = true;
+        script[i].fire = i < 4;
+    }
+    GameState gameState(std::make_unique<ScriptedInput>(script));
+    gameState.update(0.0f);
+    for (const auto& asteroid : gameState.getAsteroids()) {
+        asteroid->setVelocity(sf::Vector2f(0.0f, 0.0f));
+    }
+
+    for (int i = 0; i < 300; ++i) gameState.update(1.0f / 60.0f);
+    ASSERT_FALSE(gameState.isGameOver());
+    int scoreBefore = gameState.getScore();
+
+    size_t allocations;
+    {
+        AllocationCounter counter;
+        for (int i = 0; i < 300; ++i) gameState.update(1.0f / 60.0f);
+        allocations = counter.count();
+    }
+
+    ASSERT_FALSE(gameState.isGameOver());
+    ASSERT_FALSE(gameState.isGameWon());
+    EXPECT_GT(gameState.getScore(), scoreBefore) << "No asteroids were split during the measured ticks";
+    EXPECT_EQ(allocations, 0u);
+}
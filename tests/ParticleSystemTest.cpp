@@ -0,0 +1,168 @@
+// tests/ParticleSystemTest.cpp
+#include <gtest/gtest.h>
+#include "AllocationCounter.hpp"
+#include "GameState.hpp"
+#include "HeadlessRenderer.hpp"
+#include "ParticleSystem.hpp"
+#include "RenderSnapshot.hpp"
+
+namespace {
+// Particle i sits at x = i, so survivors can be identified by position
+void emitRow(ParticleSystem& particles, int from, int to, float lifetime) {
+    for (int i = from; i < to; ++i) {
+        particles.emit(sf::Vector2f(static_cast<float>(i), 0.0f), sf::Vector2f(0.0f, 10.0f),
+                       lifetime, sf::Color::White);
+    }
+}
+} // namespace
+
+TEST(ParticleSystemTest, IntegratesAgesAndRetires) {
+    ParticleSystem particles(8);
+    particles.emit(sf::Vector2f(0, 0), sf::Vector2f(10, -20), 0.1f, sf::Color::White);
+    particles.emit(sf::Vector2f(5, 5), sf::Vector2f(0, 40), 0.3f, sf::Color::White);
+    ASSERT_EQ(particles.size(), 2u);
+
+    particles.update(0.25f);
+    ASSERT_EQ(particles.size(), 1u);
+    EXPECT_EQ(particles.getPosition(0), sf::Vector2f(5, 15));
+    EXPECT_FLOAT_EQ(particles.getRemainingLife(0), 0.05f);
+
+    particles.update(0.1f);
+    EXPECT_TRUE(particles.empty());
+}
+
+TEST(ParticleSystemTest, DragSlowsParticles) {
+    ParticleSystem particles(1);
+    particles.setDrag(2.0f);
+    particles.emit(sf::Vector2f(0, 0), sf::Vector2f(100, 0), 1.0f, sf::Color::White);
+    particles.update(0.25f);
+    EXPECT_FLOAT_EQ(particles.getVelocity(0).x, 50.0f);
+    EXPECT_FLOAT_EQ(particles.getPosition(0).x, 12.5f);
+}
+
+TEST(ParticleSystemTest, FullRingOverwritesOldest) {
+    ParticleSystem particles(5);
+    ASSERT_EQ(particles.capacity(), 8u);
+
+    emitRow(particles, 0, 11, 1.0f);
+    ASSERT_EQ(particles.size(), 8u);
+    for (size_t i = 0; i < particles.size(); ++i) {
+        EXPECT_FLOAT_EQ(particles.getPosition(i).x, 3.0f + i);
+    }
+}
+
+TEST(ParticleSystemTest, UpdatesSpanThatWrapsAround) {
+    ParticleSystem particles(4);
+    emitRow(particles, 0, 3, 0.1f);
+    particles.update(0.2f);
+    ASSERT_TRUE(particles.empty());
+
+    // Slots 3, 0 and 1
+    emitRow(particles, 0, 3, 1.0f);
+    particles.update(0.5f);
+    ASSERT_EQ(particles.size(), 3u);
+    for (size_t i = 0; i < particles.size(); ++i) {
+        EXPECT_EQ(particles.getPosition(i), sf::Vector2f(static_cast<float>(i), 5.0f));
+        EXPECT_FLOAT_EQ(particles.getRemainingLife(i), 0.5f);
+    }
+}
+
+TEST(ParticleSystemTest, DrawsOneFadingStreakEach) {
+    ParticleSystem particles(4);
+    emitRow(particles, 0, 3, 1.0f);
+    particles.emit(sf::Vector2f(9, 9), sf::Vector2f(0, 0), 0.1f, sf::Color::White);
+    particles.update(0.5f);  // The last one expires behind three live ones
+
+    RenderCommandList commands;
+    commands.addCircle(sf::Vector2f(1, 1), 2.0f, sf::Color::Red);
+    particles.draw(commands);
+    ASSERT_EQ(commands.commands().size(), 2u);
+    const RenderCommandList::Command& lines = commands.commands()[1];
+    EXPECT_EQ(lines.kind, RenderCommandList::Kind::Lines);
+    ASSERT_EQ(lines.count, 8u);
+
+    const sf::Vertex* v = commands.vertices().data() + lines.first;
+    EXPECT_EQ(v[0].position, sf::Vector2f(0, 5));
+    EXPECT_EQ(v[1].position, sf::Vector2f(0, 5 - 10 * ParticleSystem::STREAK_SECONDS));
+    EXPECT_EQ(v[0].color.a, 127);
+    EXPECT_EQ(v[1].color.a, 0);
+    EXPECT_EQ(v[6].color.a, 0);
+
+    HeadlessRenderer headless;
+    headless.submit(commands);
+    EXPECT_EQ(headless.lastFrame().lines, 4u);
+}
+
+namespace {
+// Snapshots of a world where the ship thrusts and has just destroyed asteroids
+RenderSnapshot explodingSnapshot(uint64_t tick) {
+    RenderSnapshot snapshot;
+    snapshot.tick = tick;
+    snapshot.hasShip = true;
+    snapshot.thrusting = true;
+    snapshot.ship = {sf::Vector2f(400, 300), sf::Vector2f(400, 300), 0.0f, 0.0f};
+    snapshot.explosions.push_back({sf::Vector2f(100, 100), sf::Vector2f(0, 0), 40.0f, tick});
+    return snapshot;
+}
+} // namespace
+
+TEST(ParticleSystemTest, RendererEmitsEachExplosionOnce) {
+    SnapshotRenderer renderer;
+    RenderCommandList commands;
+
+    renderer.record(explodingSnapshot(5), 1.0f, commands);
+    size_t afterFirst = renderer.getParticles().size();
+    EXPECT_GT(afterFirst, 0u);
+
+    // Redrawn, as when rendering outpaces the simulation: no new debris and,
+    // with no time passing, no new exhaust
+    renderer.record(explodingSnapshot(5), 1.0f, commands);
+    EXPECT_EQ(renderer.getParticles().size(), afterFirst);
+
+    // One tick later: exhaust for that tick, debris for the new explosion
+    renderer.record(explodingSnapshot(6), 1.0f, commands);
+    EXPECT_GT(renderer.getParticles().size(), 2 * afterFirst);
+}
+
+TEST(ParticleSystemTest, GameEffectsAreDeterministic) {
+    // Thrust into the asteroids while firing until the ship dies
+    auto frames = [] {
+        InputState controls;
+        controls.thrust = true;
+        controls.fire = true;
+        controls.rotateLeft = true;
+        GameState game(std::make_unique<ScriptedInput>(std::vector<InputState>{controls, InputState{}}),
+                       21);
+        RenderCommandList commands;
+        HeadlessRenderer headless;
+        for (int tick = 0; tick < 600 && !game.isGameOver(); ++tick) {
+            game.update(1.0f / 60.0f);
+            commands.clear();
+            game.draw(commands);
+            headless.submit(commands);
+        }
+        EXPECT_GT(headless.totals().lines, 0u);
+        return headless.sessionDigest();
+    };
+    EXPECT_EQ(frames(), frames());
+}
+
+TEST(ParticleSystemTest, DoesNotAllocateAfterSetup) {
+    ParticleSystem particles(1024);
+    RenderCommandList commands;
+    auto frame = [&](int i) {
+        for (int j = 0; j < 100; ++j) {
+            particles.emit(sf::Vector2f(i, j), sf::Vector2f(j, i), 0.5f + j * 0.01f, sf::Color::White);
+        }
+        particles.update(1.0f / 60.0f);
+        commands.clear();
+        particles.draw(commands);
+    };
+    // Fill the ring, which also grows the command list to its largest frame
+    for (int i = 0; i < 20; ++i) frame(i);
+
+    AllocationCounter counter;
+    for (int i = 20; i < 200; ++i) frame(i);
+    EXPECT_EQ(counter.count(), 0u);
+    EXPECT_EQ(particles.size(), particles.capacity());
+}
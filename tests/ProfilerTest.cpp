@@ -0,0 +1,162 @@
+// tests/ProfilerTest.cpp
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+#include "Profiler.hpp"
+
+namespace {
+std::string readFile(const std::string& path) {
+    std::ifstream file(path);
+    std::stringstream contents;
+    contents << file.rdbuf();
+    return contents.str();
+}
+} // namespace
+
+TEST(LatencyHistogramTest, EmptyReportsZero) {
+    LatencyHistogram histogram;
+    EXPECT_EQ(histogram.count(), 0u);
+    EXPECT_EQ(histogram.percentile(0.5), 0u);
+    EXPECT_EQ(histogram.max(), 0u);
+}
+
+TEST(LatencyHistogramTest, PercentilesWithinBucketError) {
+    LatencyHistogram histogram;
+    for (uint64_t ns = 1; ns <= 10000; ++ns) {
+        histogram.add(ns * 100);
+    }
+
+    EXPECT_EQ(histogram.count(), 10000u);
+    EXPECT_EQ(histogram.max(), 1000000u);
+    EXPECT_NEAR(histogram.mean(), 500050.0, 1.0);
+
+    // Reported values never undershoot and overshoot by at most one bucket
+    uint64_t p50 = histogram.percentile(0.50);
+    uint64_t p99 = histogram.percentile(0.99);
+    EXPECT_GE(p50, 500000u);
+    EXPECT_LE(p50, 500000u * 9 / 8);
+    EXPECT_GE(p99, 990000u);
+    EXPECT_LE(p99, 1000000u);
+    EXPECT_EQ(histogram.percentile(1.0), 1000000u);
+}
+
+TEST(LatencyHistogramTest, SmallValuesAreExact) {
+    LatencyHistogram histogram;
+    for (uint64_t ns = 0; ns < 8; ++ns) {
+        histogram.add(ns);
+    }
+    EXPECT_EQ(histogram.percentile(0.5), 3u);
+    EXPECT_EQ(histogram.percentile(1.0), 7u);
+
+    histogram.clear();
+    EXPECT_EQ(histogram.count(), 0u);
+}
+
+TEST(ProfilerTest, PhasesAreRegisteredOncePerName) {
+    Profiler& profiler = Profiler::instance();
+    std::string name = "ProfilerTest::phase";
+    int first = profiler.registerPhase("ProfilerTest::phase");
+    int second = profiler.registerPhase(name.c_str());
+    EXPECT_GE(first, 0);
+    EXPECT_EQ(first, second);
+    EXPECT_NE(profiler.registerPhase("ProfilerTest::other"), first);
+}
+
+// Pool workers reach their scopes at the same moment on the first tick
+TEST(ProfilerTest, RegistersConcurrently) {
+    Profiler& profiler = Profiler::instance();
+    const char* const names[] = {"ProfilerTest::race0", "ProfilerTest::race1"};
+    std::vector<int> ids(8);
+    std::vector<std::thread> threads;
+    for (size_t t = 0; t < ids.size(); ++t) {
+        threads.emplace_back([&, t] { ids[t] = profiler.registerPhase(names[t % 2]); });
+    }
+    for (std::thread& thread : threads) thread.join();
+
+    for (size_t t = 0; t < ids.size(); ++t) {
+        EXPECT_GE(ids[t], 0);
+        EXPECT_EQ(ids[t], ids[t % 2]);
+    }
+    EXPECT_NE(ids[0], ids[1]);
+}
+
+TEST(ProfilerTest, RecordsFromManyThreads) {
+    Profiler& profiler = Profiler::instance();
+    int phase = profiler.registerPhase("ProfilerTest::threads");
+    profiler.resetStats();
+    profiler.startCapture();
+
+    std::vector<std::thread> threads;
+    for (int t = 0; t < 4; ++t) {
+        threads.emplace_back([phase] {
+            Profiler::attachThisThread();
+            for (int i = 0; i < 500; ++i) { ProfileScope scope(phase); }
+        });
+    }
+    for (std::thread& thread : threads) thread.join();
+    profiler.stopCapture();
+
+    EXPECT_EQ(profiler.capturedEvents(), 2000u);
+    for (const Profiler::PhaseStats& stats : profiler.stats()) {
+        if (std::string(stats.name) == "ProfilerTest::threads") EXPECT_EQ(stats.count, 2000u);
+    }
+}
+
+TEST(ProfilerTest, ScopesRecordOnlyOnAttachedThreads) {
+    Profiler& profiler = Profiler::instance();
+    int phase = profiler.registerPhase("ProfilerTest::scope");
+    profiler.resetStats();
+
+    auto countFor = [&]() {
+        for (const Profiler::PhaseStats& stats : profiler.stats()) {
+            if (std::string(stats.name) == "ProfilerTest::scope") return stats.count;
+        }
+        return uint64_t(0);
+    };
+
+    if (!Profiler::isThreadAttached()) {
+        { ProfileScope scope(phase); }
+        EXPECT_EQ(countFor(), 0u);
+        Profiler::attachThisThread();
+    }
+
+    { ProfileScope scope(phase); }
+    { ProfileScope scope(phase); }
+    EXPECT_EQ(countFor(), 2u);
+}
+
+TEST(ProfilerTest, ExportsCapturedEvents) {
+    Profiler& profiler = Profiler::instance();
+    int outer = profiler.registerPhase("ProfilerTest::outer");
+    int inner = profiler.registerPhase("ProfilerTest::inner");
+
+    profiler.startCapture();
+    profiler.record(outer, 1000, 5000);
+    profiler.record(inner, 2000, 3500);
+    profiler.stopCapture();
+    profiler.record(inner, 6000, 7000);   // Outside the capture
+    ASSERT_EQ(profiler.capturedEvents(), 2u);
+
+    std::string tracePath = ::testing::TempDir() + "profiler_test.json";
+    std::string csvPath = ::testing::TempDir() + "profiler_test.csv";
+    ASSERT_TRUE(profiler.writeChromeTrace(tracePath));
+    ASSERT_TRUE(profiler.writeCsv(csvPath));
+
+    std::string trace = readFile(tracePath);
+    EXPECT_NE(trace.find("\"traceEvents\""), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"ProfilerTest::outer\",\"cat\":\"frame\",\"ph\":\"X\","
+                         "\"ts\":1.000,\"dur\":4.000"), std::string::npos);
+    EXPECT_NE(trace.find("\"name\":\"ProfilerTest::inner\""), std::string::npos);
+
+    std::string csv = readFile(csvPath);
+    EXPECT_EQ(csv.rfind("phase,start_us,duration_us,depth,thread\n", 0), 0u);
+    EXPECT_NE(csv.find("ProfilerTest::inner,2.000,1.500,"), std::string::npos);
+    EXPECT_EQ(csv.find("6.000"), std::string::npos);
+
+    std::remove(tracePath.c_str());
+    std::remove(csvPath.c_str());
+}
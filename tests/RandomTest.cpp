@@ -0,0 +1,85 @@
+// tests/RandomTest.cpp
+#include <gtest/gtest.h>
+#include "GameState.hpp"
+#include "Random.hpp"
+
+TEST(RandomTest, SameSeedSameSequence) {
+    Random a(42);
+    Random b(42);
+    for (int i = 0; i < 1000; ++i) {
+        ASSERT_EQ(a.next(), b.next());
+    }
+}
+
+TEST(RandomTest, NearbySeedsDiverge) {
+    Random a(1);
+    Random b(2);
+    int equal = 0;
+    for (int i = 0; i < 100; ++i) {
+        if (a.next() == b.next()) ++equal;
+    }
+    EXPECT_LT(equal, 2);
+}
+
+TEST(RandomTest, HelpersStayInRange) {
+    Random rng(7);
+    bool sawLow = false;
+    bool sawHigh = false;
+    for (int i = 0; i < 10000; ++i) {
+        float f = rng.uniform(-2.0f, 3.0f);
+        ASSERT_GE(f, -2.0f);
+        ASSERT_LT(f, 3.0f);
+
+        int n = rng.range(6, 8);
+        ASSERT_GE(n, 6);
+        ASSERT_LE(n, 8);
+        sawLow |= n == 6;
+        sawHigh |= n == 8;
+    }
+    EXPECT_TRUE(sawLow);
+    EXPECT_TRUE(sawHigh);
+}
+
+// Same seed and inputs must give the same world, split by split
+TEST(RandomTest, SameSeedSameWorld) {
+    auto pilot = [] {
+        std::vector<InputState> script(30);
+        for (size_t i = 0; i < script.size(); ++i) {
+            script[i].rotateRight = true;
+            script[i].fire = i % 6 < 3;
+            script[i].restart = true;
+        }
+        return std::make_unique<ScriptedInput>(script);
+    };
+
+    GameState first(pilot(), 2024);
+    GameState second(pilot(), 2024);
+    for (int i = 0; i < 1200; ++i) {
+        first.update(1.0f / 60.0f);
+        second.update(1.0f / 60.0f);
+    }
+
+    ASSERT_GT(first.getScore(), 0) << "Nothing was split";
+    EXPECT_EQ(first.getScore(), second.getScore());
+    ASSERT_EQ(first.getAsteroids().size(), second.getAsteroids().size());
+    for (size_t i = 0; i < first.getAsteroids().size(); ++i) {
+        const Asteroid& a = *first.getAsteroids()[i];
+        const Asteroid& b = *second.getAsteroids()[i];
+        EXPECT_EQ(a.getPosition(), b.getPosition());
+        EXPECT_EQ(a.getVelocity(), b.getVelocity());
+        EXPECT_EQ(a.getRotationSpeed(), b.getRotationSpeed());
+        ASSERT_EQ(a.getPointCount(), b.getPointCount());
+        for (size_t p = 0; p < a.getPointCount(); ++p) {
+            EXPECT_EQ(a.getPoint(p), b.getPoint(p));
+        }
+    }
+}
+
+TEST(RandomTest, DifferentSeedDifferentWorld) {
+    GameState first(std::make_unique<NullInput>(), 1);
+    GameState second(std::make_unique<NullInput>(), 2);
+    first.update(0.0f);
+    second.update(0.0f);
+
+    EXPECT_NE(first.getAsteroids()[0]->getVelocity(), second.getAsteroids()[0]->getVelocity());
+}
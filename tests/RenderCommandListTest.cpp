@@ -0,0 +1,120 @@
+// tests/RenderCommandListTest.cpp
+#include <gtest/gtest.h>
+#include "GameState.hpp"
+#include "HeadlessRenderer.hpp"
+#include "RenderCommandList.hpp"
+
+namespace {
+const sf::Vector2f TRIANGLE[] = {{0, -1}, {-1, 1}, {1, 1}};
+
+std::unique_ptr<GameState> scriptedGame(uint32_t seed) {
+    InputState fire;
+    fire.fire = true;
+    fire.rotateRight = true;
+    return std::make_unique<GameState>(
+        std::make_unique<ScriptedInput>(std::vector<InputState>{fire, fire, InputState{}}), seed);
+}
+
+uint64_t playAndDigest(uint32_t seed, int ticks) {
+    auto game = scriptedGame(seed);
+    RenderCommandList commands;
+    HeadlessRenderer headless;
+    for (int tick = 0; tick < ticks; ++tick) {
+        game->update(1.0f / 30.0f);
+        commands.clear();
+        game->draw(commands, 0.5f);
+        headless.submit(commands);
+    }
+    return headless.sessionDigest();
+}
+} // namespace
+
+TEST(RenderCommandListTest, OutlinesAreStoredInWorldSpace) {
+    RenderCommandList commands;
+    sf::Vector2f unit[] = {{1, 0}, {0, 1}};
+    commands.addOutline(unit, 2, sf::Vector2f(100, 50), 90.0f, sf::Color::Red);
+
+    ASSERT_EQ(commands.commands().size(), 1u);
+    const RenderCommandList::Command& command = commands.commands()[0];
+    EXPECT_EQ(command.kind, RenderCommandList::Kind::LineLoop);
+    EXPECT_EQ(command.count, 2u);
+    EXPECT_EQ(command.color, sf::Color::Red);
+    EXPECT_NEAR(commands.points()[0].x, 100.0f, 1e-4f);
+    EXPECT_NEAR(commands.points()[0].y, 51.0f, 1e-4f);
+    EXPECT_NEAR(commands.points()[1].x, 99.0f, 1e-4f);
+    EXPECT_NEAR(commands.points()[1].y, 50.0f, 1e-4f);
+}
+
+TEST(RenderCommandListTest, PolygonsBecomeTriangleFans) {
+    RenderCommandList commands;
+    sf::Vector2f square[] = {{-1, -1}, {1, -1}, {1, 1}, {-1, 1}};
+    commands.addPolygon(square, 4, sf::Vector2f(), 0.0f, sf::Color::Yellow);
+
+    HeadlessRenderer headless;
+    headless.submit(commands);
+    EXPECT_EQ(headless.lastFrame().triangles, 2u);
+    EXPECT_EQ(headless.lastFrame().lineSegments, 0u);
+}
+
+TEST(RenderCommandListTest, ClearKeepsCapacity) {
+    RenderCommandList commands;
+    for (int i = 0; i < 64; ++i) {
+        commands.addOutline(TRIANGLE, 3, sf::Vector2f(i, i), 0.0f, sf::Color::White);
+        commands.addText("text", sf::Vector2f(), 12, sf::Color::White);
+    }
+    const RenderCommandList::Command* commandStorage = commands.commands().data();
+    const sf::Vector2f* pointStorage = commands.points().data();
+
+    commands.clear();
+    EXPECT_TRUE(commands.empty());
+    for (int i = 0; i < 64; ++i) {
+        commands.addOutline(TRIANGLE, 3, sf::Vector2f(i, i), 0.0f, sf::Color::White);
+        commands.addText("text", sf::Vector2f(), 12, sf::Color::White);
+    }
+    EXPECT_EQ(commands.commands().data(), commandStorage);
+    EXPECT_EQ(commands.points().data(), pointStorage);
+}
+
+TEST(RenderCommandListTest, HashTracksEveryDetail) {
+    auto build = [](float x, const char* label, sf::Color color) {
+        RenderCommandList commands;
+        commands.addOutline(TRIANGLE, 3, sf::Vector2f(x, 10), 0.0f, color);
+        commands.addCircle(sf::Vector2f(5, 5), 2.0f, sf::Color::White);
+        commands.addText(label, sf::Vector2f(10, 10), 20, sf::Color::White);
+        return commands.hash();
+    };
+
+    uint64_t base = build(10, "Score: 0", sf::Color::White);
+    EXPECT_EQ(build(10, "Score: 0", sf::Color::White), base);
+    EXPECT_NE(build(10.5f, "Score: 0", sf::Color::White), base);
+    EXPECT_NE(build(10, "Score: 20", sf::Color::White), base);
+    EXPECT_NE(build(10, "Score: 0", sf::Color::Yellow), base);
+}
+
+TEST(RenderCommandListTest, HeadlessCountsGameFrame) {
+    auto game = scriptedGame(5);
+    game->update(1.0f / 30.0f);
+    game->update(1.0f / 30.0f);
+    ASSERT_FALSE(game->isGameOver());
+
+    RenderCommandList commands;
+    game->draw(commands);
+    HeadlessRenderer headless;
+    headless.submit(commands);
+
+    uint64_t asteroidSegments = 0;
+    for (const auto& asteroid : game->getAsteroids()) {
+        asteroidSegments += asteroid->getPointCount();
+    }
+    const HeadlessRenderer::Counts& frame = headless.lastFrame();
+    EXPECT_EQ(frame.lineSegments, 3 + asteroidSegments);   // Ship hull and asteroid outlines
+    EXPECT_EQ(frame.circles, game->getShip()->getBulletManager().count());
+    EXPECT_EQ(frame.textRuns, 1u);                          // Score
+    EXPECT_EQ(headless.lastFrameHash(), commands.hash());
+}
+
+TEST(RenderCommandListTest, ReplayedSessionsRenderIdentically) {
+    // A golden frame digest: same seed and inputs, same frames
+    EXPECT_EQ(playAndDigest(77, 120), playAndDigest(77, 120));
+    EXPECT_NE(playAndDigest(77, 120), playAndDigest(78, 120));
+}
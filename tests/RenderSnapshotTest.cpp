@@ -0,0 +1,110 @@
+// tests/RenderSnapshotTest.cpp
+#include <gtest/gtest.h>
+#include "GameState.hpp"
+#include "RenderSnapshot.hpp"
+
+namespace {
+std::unique_ptr<GameState> firingGame() {
+    InputState fire;
+    fire.fire = true;
+    fire.rotateLeft = true;
+    return std::make_unique<GameState>(
+        std::make_unique<ScriptedInput>(std::vector<InputState>{fire, InputState{}}), 11);
+}
+} // namespace
+
+TEST(RenderSnapshotTest, CapturesEveryDrawnObject) {
+    auto game = firingGame();
+    for (int tick = 0; tick < 6; ++tick) {
+        game->update(1.0f / 30.0f);
+    }
+    ASSERT_FALSE(game->isGameOver());
+
+    RenderSnapshot snapshot;
+    game->captureRenderSnapshot(snapshot);
+
+    const Ship* ship = game->getShip();
+    ASSERT_TRUE(snapshot.hasShip);
+    EXPECT_EQ(snapshot.ship.position, ship->getPosition());
+    EXPECT_EQ(snapshot.ship.previousPosition, ship->getPreviousPosition());
+    EXPECT_FLOAT_EQ(snapshot.ship.rotation, ship->getState().rotation);
+    EXPECT_EQ(snapshot.bullets.size(), ship->getBulletManager().count());
+    EXPECT_GT(snapshot.bullets.size(), 0u);
+
+    const auto& asteroids = game->getAsteroids();
+    ASSERT_EQ(snapshot.asteroids.size(), asteroids.size());
+    for (size_t i = 0; i < asteroids.size(); ++i) {
+        EXPECT_EQ(snapshot.asteroids[i].pose.position, asteroids[i]->getPosition());
+        EXPECT_EQ(snapshot.asteroids[i].size, asteroids[i]->getSize());
+        EXPECT_EQ(snapshot.asteroids[i].shapeIndex, asteroids[i]->getShapeIndex());
+    }
+    EXPECT_EQ(snapshot.score, game->getScore());
+    EXPECT_EQ(snapshot.phase, Hud::Phase::Playing);
+}
+
+TEST(RenderSnapshotTest, RecapturingKeepsCapacity) {
+    auto game = firingGame();
+    game->update(0.0f);
+
+    RenderSnapshot snapshot;
+    game->captureRenderSnapshot(snapshot);
+    const RenderSnapshot::AsteroidView* storage = snapshot.asteroids.data();
+    for (int tick = 0; tick < 10; ++tick) {
+        game->update(1.0f / 30.0f);
+        game->captureRenderSnapshot(snapshot);
+        if (snapshot.asteroids.size() <= INITIAL_ASTEROID_COUNT) {
+            EXPECT_EQ(snapshot.asteroids.data(), storage);
+        }
+    }
+}
+
+TEST(RenderSnapshotTest, GameOverHasNoShip) {
+    auto game = firingGame();
+    game->update(0.0f);
+    game->getAsteroids()[0]->setPosition(game->getShip()->getPosition());
+    game->update(1.0f / 30.0f);
+    ASSERT_TRUE(game->isGameOver());
+
+    RenderSnapshot snapshot;
+    game->captureRenderSnapshot(snapshot);
+    EXPECT_FALSE(snapshot.hasShip);
+    EXPECT_TRUE(snapshot.bullets.empty());
+    EXPECT_EQ(snapshot.phase, Hud::Phase::GameOver);
+}
+
+TEST(RenderSnapshotTest, ExplosionsOutlastTheCatchUpLimit) {
+    for (int maxSteps : {MAX_CATCH_UP_STEPS, 40}) {
+        auto game = firingGame();
+        game->setMaxCatchUpSteps(maxSteps);
+        game->update(0.0f);
+        game->getAsteroids()[0]->setPosition(game->getShip()->getPosition());
+        game->update(1.0f / 30.0f);
+        ASSERT_TRUE(game->isGameOver());
+
+        // Still there after a full catch-up burst, gone after two
+        RenderSnapshot snapshot;
+        for (int tick = 1; tick < 2 * maxSteps; ++tick) game->update(1.0f / 30.0f);
+        game->captureRenderSnapshot(snapshot);
+        EXPECT_EQ(snapshot.explosions.size(), 1u) << maxSteps;
+        game->update(1.0f / 30.0f);
+        game->captureRenderSnapshot(snapshot);
+        EXPECT_TRUE(snapshot.explosions.empty()) << maxSteps;
+    }
+}
+
+TEST(RenderSnapshotTest, RendererBatchesSnapshotIntoFewCalls) {
+    auto game = firingGame();
+    for (int tick = 0; tick < 6; ++tick) {
+        game->update(1.0f / 30.0f);
+    }
+    RenderSnapshot snapshot;
+    game->captureRenderSnapshot(snapshot);
+
+    sf::RenderWindow window;
+    SnapshotRenderer renderer;
+    renderer.draw(window, snapshot, 0.5f);
+    // Lines and triangles; the score run is recorded but, with no font, not drawn
+    EXPECT_LE(renderer.getDrawCalls(), 2);
+    EXPECT_EQ(renderer.getHudRebuilds(), 1);
+    EXPECT_EQ(renderer.getCommands().commands().back().kind, RenderCommandList::Kind::Text);
+}
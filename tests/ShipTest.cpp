@@ -21,15 +21,51 @@ TEST_F(ShipTest, BulletLimit) {
     // Position ship away from screen edges
     ship->setPosition(sf::Vector2f(WINDOW_WIDTH/2, WINDOW_HEIGHT/2));
     
-    // Simulate firing max bullets
+    // Simulate firing more than max bullets, releasing fire between shots
+    InputState fire;
+    fire.fire = true;
     for (int i = 0; i < MAX_BULLETS + 2; i++) {
-        // Simulate space key press
-        // Note: In a real implementation, you might need to mock keyboard input
+        ship->setInput(fire);
         ship->update(0.016f);  // Small time step
+        ship->setInput(InputState{});
+        ship->update(0.016f);
     }
     
     // Verify bullet count doesn't exceed max
-    EXPECT_LE(ship->getBulletManager().count(), MAX_BULLETS);
+    EXPECT_EQ(ship->getBulletManager().count(), MAX_BULLETS);
+}
+
+TEST_F(ShipTest, FiresOnlyOnPress) {
+    ship->setPosition(sf::Vector2f(WINDOW_WIDTH/2, WINDOW_HEIGHT/2));
+
+    // Holding fire shoots once
+    InputState fire;
+    fire.fire = true;
+    ship->setInput(fire);
+    for (int i = 0; i < 10; i++) {
+        ship->update(0.016f);
+    }
+    EXPECT_EQ(ship->getBulletManager().count(), 1);
+}
+
+TEST_F(ShipTest, ThrustAndRotate) {
+    ship->setPosition(sf::Vector2f(WINDOW_WIDTH/2, WINDOW_HEIGHT/2));
+
+    // Facing up, thrust moves the ship up the screen
+    InputState thrust;
+    thrust.thrust = true;
+    ship->setInput(thrust);
+    ship->update(0.1f);
+    EXPECT_LT(ship->getVelocity().y, 0.0f);
+    EXPECT_FLOAT_EQ(ship->getVelocity().x, 0.0f);
+
+    // Rotating right then thrusting adds rightward velocity
+    InputState turnAndThrust;
+    turnAndThrust.rotateRight = true;
+    turnAndThrust.thrust = true;
+    ship->setInput(turnAndThrust);
+    ship->update(0.1f);
+    EXPECT_GT(ship->getVelocity().x, 0.0f);
 }
 
 TEST_F(ShipTest, ScreenWrapping) {
@@ -0,0 +1,164 @@
+// tests/SnapshotTest.cpp
+#include <gtest/gtest.h>
+#include <cstddef>
+#include <cstring>
+#include "AllocationCounter.hpp"
+#include "GameState.hpp"
+
+namespace {
+std::vector<InputState> pilotScript() {
+    std::vector<InputState> script(90);
+    for (size_t i = 0; i < script.size(); ++i) {
+        script[i].rotateRight = true;
+        script[i].thrust = i < 10;
+        script[i].fire = i % 6 < 3;
+        script[i].restart = true;
+    }
+    return script;
+}
+
+void expectSameWorld(const GameState& a, const GameState& b) {
+    EXPECT_EQ(a.getScore(), b.getScore());
+    ASSERT_EQ(a.isGameOver(), b.isGameOver());
+    if (!a.isGameOver()) {
+        EXPECT_EQ(a.getShip()->getPosition(), b.getShip()->getPosition());
+        EXPECT_EQ(a.getShip()->getBulletManager().count(), b.getShip()->getBulletManager().count());
+    }
+    ASSERT_EQ(a.getAsteroidCount(), b.getAsteroidCount());
+    ASSERT_EQ(a.getAsteroids().size(), b.getAsteroids().size());
+    for (size_t i = 0; i < a.getAsteroids().size(); ++i) {
+        const Asteroid& x = *a.getAsteroids()[i];
+        const Asteroid& y = *b.getAsteroids()[i];
+        EXPECT_EQ(x.getPosition(), y.getPosition());
+        EXPECT_EQ(x.getRotation(), y.getRotation());
+        ASSERT_EQ(x.getPointCount(), y.getPointCount());
+        for (size_t p = 0; p < x.getPointCount(); ++p) {
+            EXPECT_EQ(x.getPoint(p), y.getPoint(p));
+        }
+    }
+}
+} // namespace
+
+class SnapshotTest : public ::testing::Test {
+protected:
+    void advance(GameState& state, int ticks) {
+        for (int i = 0; i < ticks; ++i) state.update(1.0f / 60.0f);
+    }
+};
+
+// Restoring into a fresh world and replaying the same input must follow
+// the original exactly, including splits drawn from the RNG
+TEST_F(SnapshotTest, RestoredWorldContinuesIdentically) {
+    GameState original(std::make_unique<ScriptedInput>(pilotScript()), 31);
+    advance(original, 1200);
+    ASSERT_GT(original.getScore(), 0);
+
+    std::vector<uint8_t> snapshot;
+    original.saveSnapshot(snapshot);
+
+    GameState copy(std::make_unique<NullInput>(), 999);
+    copy.restoreSnapshot(snapshot);
+    expectSameWorld(original, copy);
+
+    original.setInputSource(std::make_unique<ScriptedInput>(pilotScript()));
+    copy.setInputSource(std::make_unique<ScriptedInput>(pilotScript()));
+    advance(original, 600);
+    advance(copy, 600);
+    expectSameWorld(original, copy);
+}
+
+TEST_F(SnapshotTest, RewindInPlace) {
+    GameState state(std::make_unique<ScriptedInput>(pilotScript()), 5);
+    advance(state, 200);
+
+    std::vector<uint8_t> snapshot;
+    state.saveSnapshot(snapshot);
+    int score = state.getScore();
+    size_t asteroids = state.getAsteroidCount();
+
+    advance(state, 500);
+    state.restoreSnapshot(snapshot);
+
+    EXPECT_EQ(state.getScore(), score);
+    EXPECT_EQ(state.getAsteroidCount(), asteroids);
+
+    std::vector<uint8_t> again;
+    state.saveSnapshot(again);
+    EXPECT_EQ(again, snapshot);
+}
+
+TEST_F(SnapshotTest, RestoresShipAfterGameOver) {
+    GameState state(std::make_unique<NullInput>(), 8);
+    std::vector<uint8_t> alive;
+    state.saveSnapshot(alive);
+
+    // Park an asteroid on the ship
+    state.update(0.0f);
+    const_cast<Asteroid&>(*state.getAsteroids()[0]).setPosition(state.getShip()->getPosition());
+    state.update(0.0f);
+    ASSERT_TRUE(state.isGameOver());
+
+    state.restoreSnapshot(alive);
+    EXPECT_FALSE(state.isGameOver());
+}
+
+TEST_F(SnapshotTest, RejectsForeignData) {
+    GameState state;
+    std::vector<uint8_t> snapshot;
+    state.saveSnapshot(snapshot);
+
+    std::vector<uint8_t> truncated(snapshot.begin(), snapshot.end() - 1);
+    EXPECT_THROW(state.restoreSnapshot(truncated), std::runtime_error);
+
+    std::vector<uint8_t> wrongVersion = snapshot;
+    wrongVersion[4] ^= 0xFF;
+    EXPECT_THROW(state.restoreSnapshot(wrongVersion), std::runtime_error);
+}
+
+TEST_F(SnapshotTest, RejectsOutOfRangeAsteroids) {
+    GameState state;
+    std::vector<uint8_t> snapshot;
+    state.saveSnapshot(snapshot);
+    // The last record is an asteroid
+    const size_t last = snapshot.size() - sizeof(Asteroid::State);
+
+    std::vector<uint8_t> badSize = snapshot;
+    const int32_t size = 3;
+    std::memcpy(&badSize[last + offsetof(Asteroid::State, size)], &size, sizeof(size));
+    EXPECT_THROW(state.restoreSnapshot(badSize), std::runtime_error);
+
+    std::vector<uint8_t> badShape = snapshot;
+    const uint16_t shape = Asteroid::SHAPES_PER_SIZE;
+    std::memcpy(&badShape[last + offsetof(Asteroid::State, shapeIndex)], &shape, sizeof(shape));
+    EXPECT_THROW(state.restoreSnapshot(badShape), std::runtime_error);
+
+    // Rejected before anything was restored
+    EXPECT_EQ(state.getAsteroidCount(), static_cast<size_t>(INITIAL_ASTEROID_COUNT));
+    EXPECT_NO_THROW(state.restoreSnapshot(snapshot));
+}
+
+TEST_F(SnapshotTest, RoundTripDoesNotAllocateAfterWarmUp) {
+    std::vector<InputState> script(8);
+    for (size_t i = 0; i < script.size(); ++i) {
+        script[i].rotateRight = true;
+        script[i].fire = i < 4;
+    }
+    GameState gameState(std::make_unique<ScriptedInput>(script), 17);
+    advance(gameState, 120);
+    ASSERT_FALSE(gameState.isGameOver());
+
+    std::vector<uint8_t> snapshot;
+    gameState.saveSnapshot(snapshot);
+    gameState.restoreSnapshot(snapshot);
+
+    size_t allocations;
+    {
+        AllocationCounter counter;
+        for (int i = 0; i < 50; ++i) {
+            gameState.saveSnapshot(snapshot);
+            gameState.restoreSnapshot(snapshot);
+        }
+        allocations = counter.count();
+    }
+    EXPECT_EQ(allocations, 0u);
+}
@@ -0,0 +1,82 @@
+// tests/SpatialHashTest.cpp
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <vector>
+#include "SpatialHash.hpp"
+
+class SpatialHashTest : public ::testing::Test {
+protected:
+    std::vector<uint32_t> queryIds(const sf::Vector2f& pos, float radius) {
+        std::vector<uint32_t> ids;
+        grid.query(pos, radius, [&ids](uint32_t id) { ids.push_back(id); });
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    }
+
+    SpatialHash grid{800.0f, 600.0f, 80.0f};
+};
+
+TEST_F(SpatialHashTest, EmptyGridReturnsNothing) {
+    grid.build();
+    EXPECT_TRUE(queryIds(sf::Vector2f(400, 300), 50.0f).empty());
+}
+
+TEST_F(SpatialHashTest, FindsNearbyAndSkipsFarObjects) {
+    grid.insert(0, sf::Vector2f(400, 300), 10.0f);
+    grid.insert(1, sf::Vector2f(420, 310), 10.0f);
+    grid.insert(2, sf::Vector2f(100, 500), 10.0f);
+    grid.build();
+
+    auto ids = queryIds(sf::Vector2f(405, 305), 2.0f);
+    EXPECT_EQ(ids, (std::vector<uint32_t>{0, 1}));
+}
+
+TEST_F(SpatialHashTest, QueryWrapsAroundEdges) {
+    grid.insert(7, sf::Vector2f(798, 598), 10.0f);
+    grid.build();
+
+    // Opposite corner should still see the object
+    auto ids = queryIds(sf::Vector2f(2, 2), 2.0f);
+    EXPECT_EQ(ids, (std::vector<uint32_t>{7}));
+}
+
+TEST_F(SpatialHashTest, HugeQueryVisitsEachObjectOnce) {
+    for (uint32_t i = 0; i < 50; ++i) {
+        grid.insert(i, sf::Vector2f(i * 16.0f, i * 12.0f), 5.0f);
+    }
+    grid.build();
+
+    auto ids = queryIds(sf::Vector2f(400, 300), 2000.0f);
+    ASSERT_EQ(ids.size(), 50u);
+    EXPECT_TRUE(std::adjacent_find(ids.begin(), ids.end()) == ids.end());
+}
+
+TEST_F(SpatialHashTest, RebuildReplacesContents) {
+    grid.insert(0, sf::Vector2f(400, 300), 10.0f);
+    grid.build();
+    grid.clear();
+    grid.insert(1, sf::Vector2f(400, 300), 10.0f);
+    grid.build();
+
+    EXPECT_EQ(queryIds(sf::Vector2f(400, 300), 1.0f), (std::vector<uint32_t>{1}));
+}
+
+TEST_F(SpatialHashTest, SlotStagingMatchesInsertOrder) {
+    const sf::Vector2f positions[] = {{410, 310}, {405, 305}, {30, 20}, {400, 300}};
+    SpatialHash inserted{800.0f, 600.0f, 80.0f};
+    for (uint32_t i = 0; i < 4; ++i) inserted.insert(i, positions[i], 10.0f);
+    inserted.build();
+
+    // Filled out of order, with slot 4 left empty
+    grid.resizeStaged(5);
+    for (uint32_t i : {3u, 0u, 2u, 1u}) grid.stageAt(i, i, positions[i]);
+    grid.growMaxRadius(10.0f);
+    grid.build();
+
+    EXPECT_EQ(grid.size(), 4u);
+    std::vector<uint32_t> expected, actual;
+    inserted.query(sf::Vector2f(400, 300), 20.0f, [&](uint32_t id) { expected.push_back(id); });
+    grid.query(sf::Vector2f(400, 300), 20.0f, [&](uint32_t id) { actual.push_back(id); });
+    EXPECT_EQ(actual, expected);
+    EXPECT_EQ(actual.size(), 3u);
+}
@@ -0,0 +1,79 @@
+// tests/TripleBufferTest.cpp
+#include <gtest/gtest.h>
+#include <array>
+#include <thread>
+#include "TripleBuffer.hpp"
+
+TEST(TripleBufferTest, ReaderSeesNothingUntilPublished) {
+    TripleBuffer<int> buffer;
+    EXPECT_FALSE(buffer.acquire());
+    EXPECT_EQ(buffer.readBuffer(), 0);
+
+    buffer.writeBuffer() = 7;
+    EXPECT_FALSE(buffer.acquire());
+    buffer.publish();
+    EXPECT_TRUE(buffer.acquire());
+    EXPECT_EQ(buffer.readBuffer(), 7);
+
+    // Nothing new: the reader keeps its value
+    EXPECT_FALSE(buffer.acquire());
+    EXPECT_EQ(buffer.readBuffer(), 7);
+}
+
+TEST(TripleBufferTest, ReaderSkipsToNewestPublish) {
+    TripleBuffer<int> buffer;
+    for (int value = 1; value <= 5; ++value) {
+        buffer.writeBuffer() = value;
+        buffer.publish();
+    }
+    EXPECT_TRUE(buffer.acquire());
+    EXPECT_EQ(buffer.readBuffer(), 5);
+}
+
+TEST(TripleBufferTest, WriterNeverTouchesTheReadersBuffer) {
+    TripleBuffer<int> buffer;
+    buffer.writeBuffer() = 1;
+    buffer.publish();
+    ASSERT_TRUE(buffer.acquire());
+
+    // However often the writer publishes, the held value stays put
+    for (int value = 2; value < 10; ++value) {
+        buffer.writeBuffer() = value;
+        buffer.publish();
+        EXPECT_EQ(buffer.readBuffer(), 1);
+    }
+}
+
+TEST(TripleBufferTest, ValuesArriveWholeAndInOrderAcrossThreads) {
+    // Big enough that a torn copy would show up as mismatched words
+    using Frame = std::array<uint64_t, 16>;
+    constexpr uint64_t FRAMES = 100000;
+    TripleBuffer<Frame> buffer;
+
+    std::thread writer([&buffer] {
+        for (uint64_t frame = 1; frame <= FRAMES; ++frame) {
+            buffer.writeBuffer().fill(frame);
+            buffer.publish();
+        }
+    });
+
+    uint64_t last = 0;
+    bool whole = true;
+    bool ordered = true;
+    while (last != FRAMES) {
+        if (!buffer.acquire()) {
+            std::this_thread::yield();
+            continue;
+        }
+        const Frame& frame = buffer.readBuffer();
+        for (uint64_t word : frame) {
+            whole = whole && word == frame[0];
+        }
+        ordered = ordered && frame[0] > last;
+        last = frame[0];
+    }
+    writer.join();
+
+    EXPECT_TRUE(whole);
+    EXPECT_TRUE(ordered);
+}
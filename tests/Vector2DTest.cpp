@@ -0,0 +1,104 @@
+// tests/Vector2DTest.cpp
+#include <gtest/gtest.h>
+#include <cmath>
+#include <vector>
+#include "Random.hpp"
+#include "Vector2D.hpp"
+
+TEST(Vector2DTest, ArithmeticIsConstexpr) {
+    constexpr Vec2 a(3.0f, 4.0f);
+    constexpr Vec2 b = a * 2.0f - Vec2(1.0f, 1.0f);
+    static_assert(b == Vec2(5.0f, 7.0f));
+    static_assert(-a / 2.0f == Vec2(-1.5f, -2.0f));
+    static_assert(vec2::lengthSq(a) == 25.0f);
+    static_assert(vec2::dot(a, Vec2(1.0f, 0.0f)) == 3.0f);
+    static_assert(vec2::cross(Vec2(1.0f, 0.0f), Vec2(0.0f, 1.0f)) == 1.0f);
+    SUCCEED();
+}
+
+TEST(Vector2DTest, ConvertsToAndFromSfml) {
+    sf::Vector2f v(1.0f, 2.0f);
+    Vec2 w = v;
+    sf::Vector2f back = w + Vec2(1.0f, 1.0f);
+    EXPECT_EQ(back, sf::Vector2f(2.0f, 3.0f));
+    EXPECT_FLOAT_EQ(vec2::length(sf::Vector2f(3.0f, 4.0f)), 5.0f);
+}
+
+TEST(Vector2DTest, NormalizeAndClamp) {
+    Vec2 unit = vec2::normalize(Vec2(3.0f, 4.0f));
+    EXPECT_FLOAT_EQ(unit.x, 0.6f);
+    EXPECT_FLOAT_EQ(unit.y, 0.8f);
+    EXPECT_EQ(vec2::normalize(Vec2()), Vec2());
+
+    Vec2 clamped = vec2::clampLength(Vec2(30.0f, 40.0f), 10.0f);
+    EXPECT_FLOAT_EQ(vec2::length(clamped), 10.0f);
+    EXPECT_EQ(vec2::clampLength(Vec2(3.0f, 4.0f), 10.0f), Vec2(3.0f, 4.0f));
+}
+
+TEST(Vector2DTest, AnglesFollowGameConvention) {
+    EXPECT_FLOAT_EQ(vec2::toRadians(180.0f), static_cast<float>(M_PI));
+
+    vec2::SinCos sc = vec2::sinCos(0.5f);
+    EXPECT_EQ(sc.sin, std::sin(0.5f));
+    EXPECT_EQ(sc.cos, std::cos(0.5f));
+
+    // 0 degrees faces up the screen, 90 to the right
+    Vec2 up = vec2::heading(0.0f);
+    EXPECT_FLOAT_EQ(up.x, 0.0f);
+    EXPECT_FLOAT_EQ(up.y, -1.0f);
+    Vec2 right = vec2::heading(90.0f);
+    EXPECT_FLOAT_EQ(right.x, 1.0f);
+    EXPECT_NEAR(right.y, 0.0f, 1e-6f);
+
+    Vec2 diagonal = vec2::fromAngle(static_cast<float>(M_PI / 4));
+    EXPECT_FLOAT_EQ(diagonal.x, diagonal.y);
+}
+
+namespace {
+// Odd-sized, so every kernel runs its tail too, with some zero vectors
+struct Soa {
+    std::vector<float> x, y;
+
+    explicit Soa(size_t count, uint64_t seed) : x(count), y(count) {
+        Random rng(seed);
+        for (size_t i = 0; i < count; ++i) {
+            x[i] = i % 7 == 0 ? 0.0f : rng.uniform(-500.0f, 500.0f);
+            y[i] = i % 7 == 0 ? 0.0f : rng.uniform(-500.0f, 500.0f);
+        }
+    }
+};
+constexpr size_t COUNT = 1003;
+} // namespace
+
+TEST(Vector2DTest, BatchKernelsMatchScalarExactly) {
+    Soa positions(COUNT, 1);
+    Soa velocities(COUNT, 2);
+    Soa expected = positions;
+    vec2::integrate(positions.x.data(), positions.y.data(), velocities.x.data(),
+                    velocities.y.data(), COUNT, 1.0f / 60.0f);
+    vec2::scalar::integrate(expected.x.data(), expected.y.data(), velocities.x.data(),
+                            velocities.y.data(), COUNT, 1.0f / 60.0f);
+    EXPECT_EQ(positions.x, expected.x);
+    EXPECT_EQ(positions.y, expected.y);
+
+    std::vector<float> batch(COUNT), reference(COUNT);
+    vec2::lengthsSq(velocities.x.data(), velocities.y.data(), batch.data(), COUNT);
+    vec2::scalar::lengthsSq(velocities.x.data(), velocities.y.data(), reference.data(), COUNT);
+    EXPECT_EQ(batch, reference);
+}
+
+TEST(Vector2DTest, BatchKernelsMatchHelpers) {
+    Soa positions(COUNT, 3);
+    Soa velocities(COUNT, 4);
+    Soa original = positions;
+    std::vector<float> out(COUNT);
+    vec2::lengthsSq(velocities.x.data(), velocities.y.data(), out.data(), COUNT);
+    vec2::integrate(positions.x.data(), positions.y.data(), velocities.x.data(),
+                    velocities.y.data(), COUNT, 0.25f);
+    for (size_t i = 0; i < COUNT; ++i) {
+        Vec2 velocity(velocities.x[i], velocities.y[i]);
+        EXPECT_EQ(out[i], vec2::lengthSq(velocity));
+        EXPECT_EQ(Vec2(positions.x[i], positions.y[i]),
+                  Vec2(original.x[i], original.y[i]) + velocity * 0.25f);
+    }
+}
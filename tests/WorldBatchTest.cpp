@@ -0,0 +1,115 @@
+// tests/WorldBatchTest.cpp
+#include <gtest/gtest.h>
+#include <atomic>
+#include <stdexcept>
+#include <string>
+#include <vector>
+#include "WorldBatch.hpp"
+
+namespace {
+// Spin, thrust in bursts, fire steadily and restart when dead
+std::unique_ptr<InputSource> pilot(size_t) {
+    std::vector<InputState> script(60);
+    for (size_t i = 0; i < script.size(); ++i) {
+        script[i].rotateRight = true;
+        script[i].thrust = i < 15;
+        script[i].fire = i % 6 < 3;
+        script[i].restart = true;
+    }
+    return std::make_unique<ScriptedInput>(script);
+}
+
+struct WorldSummary {
+    int score;
+    long gameOvers;
+    size_t asteroids;
+    float firstAsteroidX;
+
+    bool operator==(const WorldSummary& other) const {
+        return score == other.score && gameOvers == other.gameOvers &&
+               asteroids == other.asteroids && firstAsteroidX == other.firstAsteroidX;
+    }
+};
+
+std::vector<WorldSummary> runBatch(size_t threads) {
+    WorldBatch batch(16, 1234, pilot);
+    ThreadPool pool(threads);
+    batch.step(pool, 600, 1.0f / 60.0f);
+
+    std::vector<WorldSummary> summaries;
+    for (size_t i = 0; i < batch.size(); ++i) {
+        const GameState& world = batch.getWorld(i);
+        float x = world.getAsteroids().empty() ? 0.0f : world.getAsteroids()[0]->getPosition().x;
+        summaries.push_back({world.getScore(), batch.getStats(i).gameOvers,
+                             world.getAsteroidCount(), x});
+    }
+    return summaries;
+}
+} // namespace
+
+TEST(ThreadPoolTest, VisitsEveryIndexOnce) {
+    ThreadPool pool(4);
+    std::vector<std::atomic<int>> visits(1000);
+    pool.parallelFor(visits.size(), [&](size_t i) { visits[i].fetch_add(1); }, 7);
+
+    for (const auto& count : visits) {
+        EXPECT_EQ(count.load(), 1);
+    }
+}
+
+TEST(ThreadPoolTest, ReusableAcrossLoops) {
+    ThreadPool pool(3);
+    std::atomic<long> sum{0};
+    for (int round = 0; round < 50; ++round) {
+        pool.parallelFor(100, [&](size_t i) { sum += static_cast<long>(i); });
+    }
+    EXPECT_EQ(sum.load(), 50L * 4950L);
+}
+
+TEST(ThreadPoolTest, CatchingRethrowsLowestFailure) {
+    ThreadPool pool(4);
+    std::vector<std::atomic<int>> visits(200);
+    try {
+        pool.parallelForCatching(visits.size(), [&](size_t i) {
+            visits[i].fetch_add(1);
+            if (i % 50 == 17) throw std::runtime_error(std::to_string(i));
+        }, 3);
+        FAIL() << "Expected a rethrow";
+    } catch (const std::runtime_error& e) {
+        EXPECT_STREQ(e.what(), "17");
+    }
+    for (const auto& count : visits) {
+        EXPECT_EQ(count.load(), 1);
+    }
+
+    // The pool is still usable afterwards
+    std::atomic<int> calls{0};
+    pool.parallelForCatching(10, [&](size_t) { ++calls; });
+    EXPECT_EQ(calls.load(), 10);
+}
+
+TEST(WorldBatchTest, SeedsDifferPerWorld) {
+    EXPECT_NE(WorldBatch::worldSeed(1234, 0), WorldBatch::worldSeed(1234, 1));
+
+    WorldBatch batch(2, 1234, pilot);
+    ThreadPool pool(1);
+    batch.step(pool, 1, 0.0f);  // Fold the spawned asteroids in
+    EXPECT_NE(batch.getWorld(0).getAsteroids()[0]->getVelocity().x,
+              batch.getWorld(1).getAsteroids()[0]->getVelocity().x);
+}
+
+TEST(WorldBatchTest, ResultsIndependentOfThreadCount) {
+    std::vector<WorldSummary> serial = runBatch(1);
+    std::vector<WorldSummary> parallel = runBatch(4);
+    EXPECT_EQ(serial, parallel);
+}
+
+TEST(WorldBatchTest, CountsTicksAcrossWorlds) {
+    WorldBatch batch(8, 99, [](size_t) { return std::make_unique<NullInput>(); });
+    ThreadPool pool(2);
+    batch.step(pool, 10, 1.0f / 60.0f);
+    batch.step(pool, 5, 1.0f / 60.0f);
+
+    EXPECT_EQ(batch.totalTicks(), 8 * 15);
+    EXPECT_EQ(batch.getStats(3).ticks, 15);
+}
@@ -0,0 +1,179 @@
+// tests/WorldConfigTest.cpp
+#include <gtest/gtest.h>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include "GameState.hpp"
+#include "WorldConfig.hpp"
+
+namespace {
+std::shared_ptr<const WorldConfig> share(const WorldConfig& config) {
+    return std::make_shared<const WorldConfig>(config);
+}
+} // namespace
+
+TEST(WorldConfigTest, DefaultsAreTheClassicWorld) {
+    const WorldConfig& config = WorldConfig::defaults();
+    EXPECT_EQ(config.size(), sf::Vector2f(WINDOW_WIDTH, WINDOW_HEIGHT));
+    EXPECT_EQ(config.asteroidCount, INITIAL_ASTEROID_COUNT);
+    EXPECT_EQ(config.maxBullets, MAX_BULLETS);
+    EXPECT_FLOAT_EQ(config.tickRate, SIMULATION_TICK_RATE);
+    EXPECT_EQ(config.splitFanOut, 2);
+    EXPECT_NO_THROW(config.validate());
+}
+
+TEST(WorldConfigTest, SetParsesAndRejects) {
+    WorldConfig config;
+    config.set("width", "1600");
+    config.apply(" asteroids = 250 ");
+    EXPECT_FLOAT_EQ(config.width, 1600.0f);
+    EXPECT_EQ(config.asteroidCount, 250);
+
+    EXPECT_THROW(config.set("asteroids", "many"), std::invalid_argument);
+    EXPECT_THROW(config.set("asteroids", "12.5"), std::invalid_argument);
+    EXPECT_THROW(config.set("gravity", "1"), std::invalid_argument);
+    EXPECT_THROW(config.apply("width"), std::invalid_argument);
+    EXPECT_EQ(config.asteroidCount, 250);
+}
+
+TEST(WorldConfigTest, ValidateRejectsUnsimulatableWorlds) {
+    WorldConfig config;
+    config.height = 0.0f;
+    EXPECT_THROW(config.validate(), std::invalid_argument);
+
+    config = WorldConfig{};
+    config.asteroidMaxSpeed = config.asteroidMinSpeed - 1.0f;
+    EXPECT_THROW(config.validate(), std::invalid_argument);
+
+    // Non-finite values slip past every ordered comparison
+    config = WorldConfig{};
+    config.width = std::numeric_limits<float>::infinity();
+    EXPECT_THROW(config.validate(), std::invalid_argument);
+    config = WorldConfig{};
+    config.asteroidMaxSpeed = std::numeric_limits<float>::quiet_NaN();
+    EXPECT_THROW(config.validate(), std::invalid_argument);
+
+    // Each side fits, but not the grid both together would need
+    config = WorldConfig{};
+    config.width = config.height = 500000.0f;
+    EXPECT_THROW(config.validate(), std::invalid_argument);
+
+    EXPECT_THROW(GameState(nullptr, 1, share(config)), std::invalid_argument);
+}
+
+TEST(WorldConfigTest, PresetsAreValid) {
+    for (const std::string& name : WorldConfig::presetNames()) {
+        EXPECT_NO_THROW(WorldConfig::preset(name).validate()) << name;
+    }
+    EXPECT_EQ(WorldConfig::preset("1m").asteroidCount, 1000000);
+    EXPECT_THROW(WorldConfig::preset("2m"), std::invalid_argument);
+}
+
+TEST(WorldConfigTest, FileRoundTrip) {
+    std::string path = (std::filesystem::temp_directory_path() / "asteroids_world.cfg").string();
+    WorldConfig saved = WorldConfig::preset("bullet-hell");
+    {
+        std::ofstream file(path);
+        file << "# Written by WorldConfigTest\n\n" << saved.toString();
+    }
+    WorldConfig loaded = WorldConfig::fromFile(path);
+    EXPECT_EQ(loaded.toString(), saved.toString());
+
+    {
+        std::ofstream file(path);
+        file << "width = 900  # wider\nspeed = 3\n";
+    }
+    try {
+        WorldConfig::fromFile(path);
+        FAIL() << "Unknown key accepted";
+    } catch (const std::runtime_error& e) {
+        EXPECT_NE(std::string(e.what()).find(":2:"), std::string::npos) << e.what();
+    }
+    std::remove(path.c_str());
+
+    EXPECT_THROW(WorldConfig::fromFile(path), std::runtime_error);
+}
+
+TEST(WorldConfigTest, GameStateUsesConfiguredWorld) {
+    WorldConfig config;
+    config.width = 2000.0f;
+    config.height = 1000.0f;
+    config.asteroidCount = 300;  // Too many for the ring, so they scatter
+    GameState game(std::make_unique<NullInput>(), 5, share(config));
+
+    EXPECT_EQ(game.getAsteroidCount(), 300u);
+    EXPECT_EQ(game.getShip()->getPosition(), sf::Vector2f(1000.0f, 500.0f));
+    for (const auto& asteroid : game.getAsteroids()) {
+        sf::Vector2f pos = asteroid->getPosition();
+        EXPECT_GE(pos.x, 0.0f);
+        EXPECT_LE(pos.x, config.width);
+        EXPECT_GE(pos.y, 0.0f);
+        EXPECT_LE(pos.y, config.height);
+        EXPECT_FALSE(CollisionManager::checkCollision(*game.getShip(), *asteroid));
+    }
+
+    // Nothing is hit at spawn, and objects wrap at the configured edges
+    game.update(1.0f / 30.0f);
+    EXPECT_FALSE(game.isGameOver());
+    const auto& asteroids = game.getAsteroids();
+    asteroids[0]->setPosition(sf::Vector2f(config.width + 5.0f, 10.0f));
+    asteroids[0]->update(0.0f);
+    EXPECT_FLOAT_EQ(asteroids[0]->getPosition().x, 0.0f);
+}
+
+TEST(WorldConfigTest, SplitFanOut) {
+    WorldConfig config;
+    config.splitFanOut = 5;
+    InputState fire;
+    fire.fire = true;
+    GameState game(std::make_unique<ScriptedInput>(std::vector<InputState>{InputState{}, fire},
+                                                   false),
+                   9, share(config));
+    game.update(0.0f);
+
+    // Ship faces right with one asteroid in its line of fire
+    Ship::State pose = game.getShip()->getState();
+    pose.body = {sf::Vector2f(100, 300), sf::Vector2f(100, 300), sf::Vector2f(0, 0)};
+    pose.rotation = pose.previousRotation = 90.0f;
+    game.getShip()->setState(pose);
+    const auto& asteroids = game.getAsteroids();
+    for (const auto& asteroid : asteroids) {
+        asteroid->setPosition(sf::Vector2f(600, 500));
+        asteroid->setVelocity(sf::Vector2f(0, 0));
+    }
+    asteroids[0]->setPosition(sf::Vector2f(180, 300));
+
+    game.update(0.25f);
+    EXPECT_EQ(game.getScore(), POINTS_LARGE_ASTEROID);
+    EXPECT_EQ(game.getAsteroidCount(), INITIAL_ASTEROID_COUNT - 1 + 5u);
+}
+
+TEST(WorldConfigTest, HeldFireRepeatsAtFireInterval) {
+    WorldConfig config;
+    config.maxBullets = 100;
+    config.fireInterval = 0.1f;
+    config.bulletSpeed = 50.0f;  // Every bullet stays alive for the whole second
+    Ship ship(config);
+    ship.setPosition(config.size() / 2.0f);
+
+    InputState fire;
+    fire.fire = true;
+    for (int tick = 0; tick < 30; ++tick) {
+        ship.setInput(fire);
+        ship.update(1.0f / 30.0f);
+    }
+    // Shots at 0, 0.1, ... 0.9 s, give or take float rounding of the cooldown
+    size_t fired = ship.getBulletManager().count();
+    EXPECT_GE(fired, 9u);
+    EXPECT_LE(fired, 10u);
+
+    // The classic rule: one shot per press, however long it is held
+    Ship classic;
+    classic.setPosition(config.size() / 2.0f);
+    for (int tick = 0; tick < 10; ++tick) {
+        classic.setInput(fire);
+        classic.update(1.0f / 30.0f);
+    }
+    EXPECT_EQ(classic.getBulletManager().count(), 1u);
+}